@@ -58,3 +58,93 @@ void radixsort_for_str_ptr(uchar **base, uint number_of_elements, size_t size_of
   next:;
   }
 }
+
+
+/*
+  MSD radixsort for pointers to fixed length strings.
+
+  Strings are distributed by the value of one byte at a time starting from
+  the first one. Groups smaller than RADIX_MSD_MIN_GROUP and groups whose
+  strings have the first RADIX_MSD_MAX_DEPTH bytes in common are sorted
+  with my_qsort2() comparing only the remaining bytes. Unlike
+  radixsort_for_str_ptr() the number of passes does not grow with the
+  length of the strings, so it is suitable for long strings.
+  Needs an extra buffer of number_of_elements pointers.
+*/
+
+#define RADIX_MSD_MIN_GROUP 64
+#define RADIX_MSD_MAX_DEPTH 16
+
+typedef struct st_radix_suffix
+{
+  size_t offset;
+  size_t length;
+} RADIX_SUFFIX;
+
+static int radix_cmp_suffix(const void *arg, const void *a, const void *b)
+{
+  const RADIX_SUFFIX *suffix= (const RADIX_SUFFIX*) arg;
+  return memcmp(*(const uchar**) a + suffix->offset,
+                *(const uchar**) b + suffix->offset, suffix->length);
+}
+
+my_bool radixsort_msd_is_appliccable(uint n_items, size_t size_of_element)
+{
+  return size_of_element > 0 && n_items >= 1000;
+}
+
+static void radixsort_msd(uchar **base, uint number_of_elements,
+                          size_t size_of_element, uchar **buffer, size_t pass)
+{
+  uchar **end,**ptr;
+  uint32 count[256], sum, group_start;
+  uint i;
+
+  end=base+number_of_elements;
+  for (; pass < size_of_element ; pass++)
+  {
+    if (number_of_elements < RADIX_MSD_MIN_GROUP ||
+        pass == RADIX_MSD_MAX_DEPTH)
+    {
+      RADIX_SUFFIX suffix;
+      suffix.offset= pass;
+      suffix.length= size_of_element - pass;
+      my_qsort2(base, number_of_elements, sizeof(uchar*), radix_cmp_suffix,
+                &suffix);
+      return;
+    }
+    bzero((uchar*) count,sizeof(uint32)*256);
+    for (ptr= base ; ptr < end ; ptr++)
+      count[ptr[0][pass]]++;
+    /* All strings have the same byte here: go on with the next one */
+    if (count[base[0][pass]] != number_of_elements)
+      break;
+  }
+  if (pass == size_of_element)
+    return;
+
+  /* Turn the counters into the start positions of the groups */
+  for (i= 0, sum= 0 ; i < 256 ; i++)
+  {
+    uint32 n= count[i];
+    count[i]= sum;
+    sum+= n;
+  }
+  /* Distribute: after this count[i] is the end position of group i */
+  for (ptr= base ; ptr < end ; ptr++)
+    buffer[count[ptr[0][pass]]++]= *ptr;
+  memcpy(base, buffer, number_of_elements * sizeof(uchar*));
+
+  for (i= 0, group_start= 0 ; i < 256 ; group_start= count[i++])
+  {
+    if (count[i] - group_start > 1)
+      radixsort_msd(base + group_start, count[i] - group_start,
+                    size_of_element, buffer, pass + 1);
+  }
+}
+
+void radixsort_msd_for_str_ptr(uchar **base, uint number_of_elements,
+                               size_t size_of_element, uchar **buffer)
+{
+  radixsort_msd(base, number_of_elements, size_of_element, buffer, 0);
+}
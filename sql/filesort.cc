@@ -56,9 +56,12 @@ static uint suffix_length(ulong string_length);
 static uint sortlength(THD *thd, SORT_FIELD *sortorder, uint s_length,
 		       bool *multi_byte_charset);
 static SORT_ADDON_FIELD *get_addon_fields(TABLE *table, uint sortlength,
-                                          LEX_STRING *addon_buf);
+                                          LEX_STRING *addon_buf,
+                                          bool *packed_addons);
 static void unpack_addon_fields(struct st_sort_addon_field *addon_field,
                                 uchar *buff, uchar *buff_end);
+static void unpack_packed_addon_fields(struct st_sort_addon_field *addon_field,
+                                       uchar *buff, uchar *buff_end);
 static bool check_if_pq_applicable(Sort_param *param, SORT_INFO *info,
                                    TABLE *table,
                                    ha_rows records, size_t memory_available);
@@ -77,7 +80,8 @@ void Sort_param::init_for_filesort(uint sortlen, TABLE *table,
       Get the descriptors of all fields whose values are appended 
       to sorted fields and get its total length in addon_buf.length
     */
-    addon_field= get_addon_fields(table, sort_length, &addon_buf);
+    addon_field= get_addon_fields(table, sort_length, &addon_buf,
+                                  &using_packed_addons);
   }
   if (addon_field)
   {
@@ -185,7 +189,9 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
 
   sort->addon_buf=    param.addon_buf;
   sort->addon_field=  param.addon_field;
-  sort->unpack=       unpack_addon_fields;
+  sort->using_packed_addons= param.using_packed_addons;
+  sort->unpack=       (param.using_packed_addons ?
+                       unpack_packed_addon_fields : unpack_addon_fields);
   if (multi_byte_charset &&
       !(param.tmp_buffer= (char*) my_malloc(param.sort_length,
                                             MYF(MY_WME | MY_THREAD_SPECIFIC))))
@@ -701,7 +707,7 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
   handler *file;
   MY_BITMAP *save_read_set, *save_write_set;
   Item *sort_cond;
-  ha_rows retval;
+  ha_rows retval, written_rows= 0;
   DBUG_ENTER("find_all_keys");
   DBUG_PRINT("info",("using: %s",
                      (select ? select->quick ? "ranges" : "where":
@@ -821,6 +827,7 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
         {
           if (write_keys(param, fs_info, idx, buffpek_pointers, tempfile))
             goto err;
+          written_rows+= MY_MIN(idx, param->max_rows);
 	  idx= 0;
 	  indexpos++;
         }
@@ -858,12 +865,14 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
     file->print_error(error,MYF(ME_ERROR_LOG));
     DBUG_RETURN(HA_POS_ERROR);
   }
-  if (indexpos && idx &&
-      write_keys(param, fs_info, idx, buffpek_pointers, tempfile))
-    DBUG_RETURN(HA_POS_ERROR);			/* purecov: inspected */
-  retval= (my_b_inited(tempfile) ?
-           (ha_rows) (my_b_tell(tempfile)/param->rec_length) :
-           idx);
+  if (indexpos && idx)
+  {
+    if (write_keys(param, fs_info, idx, buffpek_pointers, tempfile))
+      DBUG_RETURN(HA_POS_ERROR);		/* purecov: inspected */
+    written_rows+= MY_MIN(idx, param->max_rows);
+  }
+  /* Records with packed addon fields are of different length */
+  retval= my_b_inited(tempfile) ? written_rows : idx;
   DBUG_PRINT("info", ("find_all_keys return %llu", (ulonglong) retval));
   DBUG_RETURN(retval);
 
@@ -899,12 +908,10 @@ static bool
 write_keys(Sort_param *param,  SORT_INFO *fs_info, uint count,
            IO_CACHE *buffpek_pointers, IO_CACHE *tempfile)
 {
-  size_t rec_length;
   uchar **end;
   BUFFPEK buffpek;
   DBUG_ENTER("write_keys");
 
-  rec_length= param->rec_length;
   uchar **sort_keys= fs_info->get_sort_keys();
 
   fs_info->sort_buffer(param, count);
@@ -922,7 +929,8 @@ write_keys(Sort_param *param,  SORT_INFO *fs_info, uint count,
     count=(uint) param->max_rows;               /* purecov: inspected */
   buffpek.count=(ha_rows) count;
   for (end=sort_keys+count ; sort_keys != end ; sort_keys++)
-    if (my_b_write(tempfile, (uchar*) *sort_keys, (uint) rec_length))
+    if (my_b_write(tempfile, (uchar*) *sort_keys,
+                   param->get_record_length(*sort_keys)))
       goto err;
   if (my_b_write(buffpek_pointers, (uchar*) &buffpek, sizeof(buffpek)))
     goto err;
@@ -1214,14 +1222,27 @@ static void make_sortkey(Sort_param *param, uchar *to, uchar *ref_pos)
     /* 
       Save field values appended to sorted fields.
       First null bit indicators are appended then field values follow.
-      In this implementation we use fixed layout for field values -
-      the same for all records.
+      Without packed addon fields we use fixed layout for field values -
+      the same for all records. Packed values follow each other and
+      their total length is stored before the null bit indicators.
     */
     SORT_ADDON_FIELD *addonf= param->addon_field;
     uchar *nulls= to;
     DBUG_ASSERT(addonf != 0);
     memset(nulls, 0, addonf->offset);
     to+= addonf->offset;
+    if (param->using_packed_addons)
+    {
+      for ( ; (field= addonf->field) ; addonf++)
+      {
+        if (addonf->null_bit && field->is_null())
+          nulls[addonf->null_offset]|= addonf->null_bit;
+        else
+          to= field->pack(to, field->ptr);
+      }
+      int2store(nulls, (uint) (to - nulls));
+      return;
+    }
     for ( ; (field= addonf->field) ; addonf++)
     {
       if (addonf->null_bit && field->is_null())
@@ -1441,7 +1462,10 @@ static bool check_if_pq_applicable(Sort_param *param,
         /* Make attached data to be references instead of fields. */
         my_free(filesort_info->addon_field);
         filesort_info->addon_field= NULL;
+        filesort_info->using_packed_addons= false;
+        filesort_info->unpack= unpack_addon_fields;
         param->addon_field= NULL;
+        param->using_packed_addons= false;
 
         param->res_length= param->ref_length;
         param->sort_length+= param->ref_length;
@@ -1533,6 +1557,62 @@ ulong read_to_buffer(IO_CACHE *fromfile, BUFFPEK *buffpek,
 } /* read_to_buffer */
 
 
+/**
+  Read records with packed addon fields to buffer.
+
+  The records are of different length, so we read as many bytes as the
+  buffer of the BUFFPEK can hold and take all complete records that
+  belong to it. The buffer has room for max_keys records of maximal
+  length, so at least as many records are read if there are any left.
+
+  @retval  Number of bytes read
+           (ulong)-1 if something goes wrong
+*/
+
+static ulong read_packed_to_buffer(IO_CACHE *fromfile, BUFFPEK *buffpek,
+                                   Sort_param *param)
+{
+  ha_rows count= 0;
+  ulong length= 0;
+
+  if (buffpek->count)
+  {
+    uchar *record= buffpek->base;
+    my_off_t buff_length= MY_MIN(buffpek->max_keys * param->rec_length,
+                                 fromfile->end_of_file - buffpek->file_pos);
+    if (unlikely(my_b_pread(fromfile, record, (size_t) buff_length,
+                            buffpek->file_pos)))
+      return ((ulong) -1);
+    while (count < buffpek->count &&
+           length + param->sort_length + SORT_ADDON_LENGTH_BYTES <=
+           buff_length)
+    {
+      uint rec_length= param->get_record_length(record);
+      if (length + rec_length > buff_length)
+        break;
+      record+= rec_length;
+      length+= rec_length;
+      count++;
+    }
+    DBUG_ASSERT(count);
+    buffpek->key= buffpek->base;
+    buffpek->file_pos+= length;                 /* New filepos */
+    buffpek->count-= count;
+    buffpek->mem_count= count;
+  }
+  return (length);
+}
+
+
+static inline ulong read_to_buffer(IO_CACHE *fromfile, BUFFPEK *buffpek,
+                                   Sort_param *param)
+{
+  if (param->using_packed_addons)
+    return read_packed_to_buffer(fromfile, buffpek, param);
+  return read_to_buffer(fromfile, buffpek, param->rec_length);
+}
+
+
 /**
   Put all room used by freed buffer to use in adjacent buffer.
 
@@ -1639,6 +1719,8 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
     cmp= get_ptr_compare(sort_length);
     first_cmp_arg= (void*) &sort_length;
   }
+  /* Duplicates are removed only for Unique, which has no addon fields */
+  DBUG_ASSERT(!unique_buff || !param->using_packed_addons);
   if (unlikely(init_queue(&queue, (uint) (Tb-Fb)+1, offsetof(BUFFPEK,key), 0,
                           (queue_compare) cmp, first_cmp_arg, 0, 0)))
     DBUG_RETURN(1);                                /* purecov: inspected */
@@ -1646,12 +1728,14 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
   {
     buffpek->base= strpos;
     buffpek->max_keys= maxcount;
-    bytes_read= read_to_buffer(from_file, buffpek, rec_length);
+    bytes_read= read_to_buffer(from_file, buffpek, param);
     if (unlikely(bytes_read == (ulong) -1))
       goto err;					/* purecov: inspected */
 
-    strpos+= bytes_read;
-    buffpek->max_keys= buffpek->mem_count;	// If less data in buffers than expected
+    /* If less data in buffers than expected */
+    if (buffpek->mem_count < buffpek->max_keys)
+      buffpek->max_keys= buffpek->mem_count;
+    strpos+= buffpek->max_keys * rec_length;
     queue_insert(&queue, (uchar*) buffpek);
   }
 
@@ -1724,6 +1808,8 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
       */          
       if (!check_dupl_count || dupl_count >= min_dupl_count)
       {
+        if (param->using_packed_addons)
+          wr_len= param->get_record_length(src) - wr_offset;
         if (my_b_write(to_file, src+wr_offset, wr_len))
           goto err;                           /* purecov: inspected */
       }
@@ -1741,11 +1827,11 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
       }
 
     skip_duplicate:
-      buffpek->key+= rec_length;
+      buffpek->key+= param->get_record_length(buffpek->key);
       if (! --buffpek->mem_count)
       {
         if (unlikely(!(bytes_read= read_to_buffer(from_file, buffpek,
-                                                  rec_length))))
+                                                  param))))
         {
           (void) queue_remove_top(&queue);
           reuse_freed_buff(&queue, buffpek, rec_length);
@@ -1801,7 +1887,19 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
       buffpek->count= 0;                        /* Don't read more */
     }
     max_rows-= buffpek->mem_count;
-    if (flag == 0)
+    if (param->using_packed_addons)
+    {
+      /* The records are of different length, write them one by one */
+      src= buffpek->key;
+      for (ha_rows i= 0 ; i < buffpek->mem_count ; i++)
+      {
+        uint length= param->get_record_length(src);
+        if (my_b_write(to_file, src + wr_offset, length - wr_offset))
+          goto err;
+        src+= length;
+      }
+    }
+    else if (flag == 0)
     {
       if (my_b_write(to_file, (uchar*) buffpek->key,
                      (size_t)(rec_length*buffpek->mem_count)))
@@ -1828,7 +1926,7 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
   }
   while (likely(!(error=
                   (bytes_read= read_to_buffer(from_file, buffpek,
-                                              rec_length)) == (ulong) -1)) &&
+                                              param)) == (ulong) -1)) &&
          bytes_read != 0);
 
 end:
@@ -2038,11 +2136,17 @@ bool filesort_use_addons(TABLE *table, uint sortlength,
   @param ptabfield           Array of references to the table fields
   @param sortlength          Total length of sorted fields
   @param [out] addon_buf     Buffer to us for appended fields
+  @param [out] packed_addons Set to true if the appended values are to be
+                             packed, see SORT_ADDON_FIELD
 
   @note
     The null bits for the appended values are supposed to be put together
     and stored the buffer just ahead of the value of the first field.
 
+  @note
+    The values are packed if there are strings among them, as their
+    actual length is usually much smaller than the maximal one.
+
   @return
     Pointer to the layout descriptors for the appended fields, if any
   @retval
@@ -2050,12 +2154,14 @@ bool filesort_use_addons(TABLE *table, uint sortlength,
 */
 
 static SORT_ADDON_FIELD *
-get_addon_fields(TABLE *table, uint sortlength, LEX_STRING *addon_buf)
+get_addon_fields(TABLE *table, uint sortlength, LEX_STRING *addon_buf,
+                 bool *packed_addons)
 {
   Field **pfield;
   Field *field;
   SORT_ADDON_FIELD *addonf;
   uint length, fields, null_fields;
+  uint prefix_length= 0;
   MY_BITMAP *read_set= table->read_set;
   DBUG_ENTER("get_addon_fields");
 
@@ -2071,20 +2177,41 @@ get_addon_fields(TABLE *table, uint sortlength, LEX_STRING *addon_buf)
   */
   addon_buf->str= 0;
   addon_buf->length= 0;
+  *packed_addons= false;
 
   // see remove_const() for HA_SLOW_RND_POS explanation
   if (table->file->ha_table_flags() & HA_SLOW_RND_POS)
     sortlength= 0;
 
-  if (!filesort_use_addons(table, sortlength, &length, &fields, &null_fields) ||
-      !my_multi_malloc(MYF(MY_WME | MY_THREAD_SPECIFIC), &addonf,
+  if (!filesort_use_addons(table, sortlength, &length, &fields, &null_fields))
+    DBUG_RETURN(0);
+
+  if (length + SORT_ADDON_LENGTH_BYTES <= UINT_MAX16)
+  {
+    for (pfield= table->field; (field= *pfield) ; pfield++)
+    {
+      if (bitmap_is_set(read_set, field->field_index) &&
+          (field->real_type() == MYSQL_TYPE_VARCHAR ||
+           field->real_type() == MYSQL_TYPE_STRING))
+      {
+        *packed_addons= true;
+        prefix_length= SORT_ADDON_LENGTH_BYTES;
+        length+= prefix_length;
+        break;
+      }
+    }
+  }
+
+  if (!my_multi_malloc(MYF(MY_WME | MY_THREAD_SPECIFIC), &addonf,
                        sizeof(SORT_ADDON_FIELD) * (fields+1),
                        &addon_buf->str, length, NullS))
-
+  {
+    *packed_addons= false;
     DBUG_RETURN(0);
+  }
 
   addon_buf->length= length;
-  length= (null_fields+7)/8;
+  length= prefix_length + (null_fields+7)/8;
   null_fields= 0;
   for (pfield= table->field; (field= *pfield) ; pfield++)
   {
@@ -2094,7 +2221,7 @@ get_addon_fields(TABLE *table, uint sortlength, LEX_STRING *addon_buf)
     addonf->offset= length;
     if (field->maybe_null())
     {
-      addonf->null_offset= null_fields/8;
+      addonf->null_offset= prefix_length + null_fields/8;
       addonf->null_bit= 1<<(null_fields & 7);
       null_fields++;
     }
@@ -2148,6 +2275,34 @@ unpack_addon_fields(struct st_sort_addon_field *addon_field, uchar *buff,
   }
 }
 
+
+/**
+  Unpack packed values appended to sorted fields.
+
+  The same as unpack_addon_fields() but the values are stored one after
+  another starting from the offset of the first one.
+*/
+
+static void
+unpack_packed_addon_fields(struct st_sort_addon_field *addon_field,
+                           uchar *buff, uchar *buff_end)
+{
+  Field *field;
+  SORT_ADDON_FIELD *addonf= addon_field;
+  const uchar *from= buff + addonf->offset;
+
+  for ( ; (field= addonf->field) ; addonf++)
+  {
+    if (addonf->null_bit && (addonf->null_bit & buff[addonf->null_offset]))
+    {
+      field->set_null();
+      continue;
+    }
+    field->set_notnull();
+    from= field->unpack(field->ptr, from, buff_end, 0);
+  }
+}
+
 /*
 ** functions to change a double or float to a sortable string
 ** The following should work for IEEE
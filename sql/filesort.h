@@ -87,7 +87,7 @@ class SORT_INFO
 
 public:
   SORT_INFO()
-    :addon_field(0), record_pointers(0)
+    :addon_field(0), using_packed_addons(false), record_pointers(0)
   {
     buffpek.str= 0;
     my_b_clear(&io_cache);
@@ -109,6 +109,7 @@ class SORT_INFO
     record_pointers= 0;
     buffpek.str= 0;
     addon_field= 0;
+    using_packed_addons= false;
   }
 
 
@@ -116,6 +117,7 @@ class SORT_INFO
   LEX_STRING buffpek;           /* Buffer for buffpek structures */
   LEX_STRING addon_buf;         /* Pointer to a buffer if sorted with fields */
   struct st_sort_addon_field *addon_field;     /* Pointer to the fields info */
+  bool using_packed_addons;     /* Records in io_cache are of varying length */
   /* To unpack back */
   void    (*unpack)(struct st_sort_addon_field *, uchar *, uchar *);
   uchar     *record_pointers;    /* If sorted in memory */
@@ -172,6 +172,19 @@ void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
     my_free(buffer);
     return;
   }
+  /*
+    Keys that are too long or too many for the LSD radixsort above are
+    distributed by their leading bytes, the small groups are sorted by
+    comparison of the rest of the keys.
+  */
+  if (radixsort_msd_is_appliccable(count, param->sort_length) &&
+      (buffer= (uchar**) my_malloc(count*sizeof(char*),
+                                   MYF(MY_THREAD_SPECIFIC))))
+  {
+    radixsort_msd_for_str_ptr(keys, count, param->sort_length, buffer);
+    my_free(buffer);
+    return;
+  }
   
   my_qsort2(keys, count, sizeof(uchar*), get_ptr_compare(size), &size);
 }
@@ -3742,6 +3742,14 @@ class handler :public Sql_alloc
     ha_rnd_end();
     return error;
   }
+  /**
+    Tell the engine that rnd_pos() is going to be called with this position
+    soon, so that it can start reading the row in the background.
+
+    @return TRUE if the engine reads rows ahead, FALSE if it does not, and
+            need not be told about the other positions of the batch
+  */
+  virtual bool rnd_pos_prefetch(const uchar *pos) { return FALSE; }
   virtual int read_first_row(uchar *buf, uint primary_key);
 public:
 
@@ -824,6 +824,24 @@ int Mrr_ordered_rndpos_reader::refill_from_index_reader()
 
   rowid_buffer->setup_reading(file->ref_length,
                               is_mrr_assoc ? sizeof(range_id_t) : 0);
+
+  /*
+    Let the engine start reading the rows for all rowids in the buffer
+    while we're returning them one by one. Stop as soon as the engine
+    says it does not read rows ahead.
+  */
+  Lifo_buffer_iterator it;
+  uchar *prev_rowid= NULL;
+  it.init(rowid_buffer);
+  while (!it.read())
+  {
+    if (!prev_rowid || file->cmp_ref(it.read_ptr1, prev_rowid))
+    {
+      if (!file->rnd_pos_prefetch(it.read_ptr1))
+        break;
+    }
+    prev_rowid= it.read_ptr1;
+  }
   DBUG_RETURN(rowid_buffer->is_empty()? HA_ERR_END_OF_FILE : 0);
 }
 
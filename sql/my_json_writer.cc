@@ -150,6 +150,14 @@ void Json_writer::add_size(longlong val)
 }
 
 
+void Json_writer::add_ull(ulonglong val)
+{
+  char buf[64];
+  my_snprintf(buf, sizeof(buf), "%llu", val);
+  add_unquoted_str(buf);
+}
+
+
 void Json_writer::add_double(double val)
 {
   char buf[64];
@@ -172,7 +180,7 @@ void Json_writer::add_null()
 
 void Json_writer::add_unquoted_str(const char* str)
 {
-  if (fmt_helper.on_add_str(str, 0))
+  if (fmt_helper.on_add_str(str, 0, false))
     return;
 
   if (!element_started)
@@ -336,26 +344,32 @@ void Single_line_formatting_helper::on_start_object()
 
 
 bool Single_line_formatting_helper::on_add_str(const char *str,
-                                               size_t num_bytes)
+                                               size_t num_bytes,
+                                               bool quoted)
 {
   if (state == IN_ARRAY)
   {
     size_t len= num_bytes ? num_bytes : strlen(str);
+    size_t quotes_len= quoted ? 2 : 0;
 
     // New length will be:
     //  "$string", 
     //  quote + quote + comma + space = 4
-    if (line_len + len + 4 > MAX_LINE_LEN)
+    if (line_len + len + quotes_len + 2 > MAX_LINE_LEN)
     {
       disable_and_flush();
       return false; // didn't handle the last element
     }
 
-    //append string to array
+    //append string to array, quoted strings are kept with their quotes
+    if (quoted)
+      *(buf_ptr++)= '"';
     memcpy(buf_ptr, str, len);
     buf_ptr+=len;
+    if (quoted)
+      *(buf_ptr++)= '"';
     *(buf_ptr++)= 0;
-    line_len += (uint)len + 4;
+    line_len += (uint) (len + quotes_len + 2);
     return true; // handled
   }
 
@@ -388,9 +402,7 @@ void Single_line_formatting_helper::flush_on_one_line()
     {
       if (nr != 1)
         owner->output.append(", ");
-      owner->output.append('"');
       owner->output.append(str);
-      owner->output.append('"');
     }
     nr++;
 
@@ -427,7 +439,10 @@ void Single_line_formatting_helper::disable_and_flush()
     {
       //if (nr == 1)
       //  owner->start_array();
-      owner->add_str(str);
+      if (*str == '"')
+        owner->add_str(str + 1, strlen(str) - 2);
+      else
+        owner->add_unquoted_str(str);
     }
     
     nr++;
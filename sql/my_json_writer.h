@@ -93,7 +93,7 @@ class Single_line_formatting_helper
   void on_start_object();
   // on_end_object() is not needed.
    
-  bool on_add_str(const char *str, size_t num_bytes);
+  bool on_add_str(const char *str, size_t num_bytes, bool quoted= true);
 
   void flush_on_one_line();
   void disable_and_flush();
@@ -194,6 +194,7 @@ class Json_writer
   void add_table_name(const TABLE* table);
 
   void add_ll(longlong val);
+  void add_ull(ulonglong val);
   void add_size(longlong val);
   void add_double(double val);
   void add_bool(bool val);
@@ -3197,6 +3197,54 @@ double records_in_column_ranges(PARAM *param, uint idx,
 } 
 
 
+static int cmp_selectivity(const double *a, const double *b)
+{
+  return *a < *b ? -1 : (*a > *b ? 1 : 0);
+}
+
+
+/*
+  Combine the selectivities of conditions over different columns of a table
+
+  @param thd   Thread handle
+  @param sels  Selectivities of the conditions
+  @param n     Number of elements in sels
+
+  @details
+    By default the conditions are assumed to be independent and their
+    selectivities are multiplied. With optimizer_selectivity_backoff the
+    conditions are assumed to be correlated, as it is often the case for
+    conditions like "country='US' AND state='CA'": the selectivities are
+    sorted, the most selective one is taken as is, the next one is taken
+    with the exponent 1/2, the next one with the exponent 1/4 and so on.
+    The result is between the product of the selectivities and the
+    smallest of them.
+
+  @note
+    The elements of sels may be reordered.
+
+  @return
+    The selectivity of the conjunction of the conditions
+*/
+
+static double combine_cond_selectivities(THD *thd, double *sels, uint n)
+{
+  double sel= 1.0;
+  if (!thd->variables.optimizer_selectivity_backoff)
+  {
+    for (uint i= 0; i < n; i++)
+      sel*= sels[i];
+    return sel;
+  }
+
+  my_qsort(sels, n, sizeof(double), (qsort_cmp) cmp_selectivity);
+  double exponent= 1.0;
+  for (uint i= 0; i < n; i++, exponent/= 2)
+    sel*= pow(sels[i], exponent);
+  return sel;
+}
+
+
 /*
   Calculate the selectivity of the condition imposed on the rows of a table
 
@@ -3223,8 +3271,9 @@ double records_in_column_ranges(PARAM *param, uint idx,
        where approaches #1 and #2 do not provide selectivity data).
 
   NOTE
-    Currently the selectivities of range conditions over different columns are
-    considered independent. 
+    The selectivities of range conditions over different columns are
+    considered independent, unless optimizer_selectivity_backoff is set
+    (see combine_cond_selectivities()).
 
   RETURN
     FALSE  on success
@@ -3264,6 +3313,16 @@ bool calculate_cond_selectivity_for_table(THD *thd, TABLE *table, Item **cond)
     DBUG_RETURN(TRUE);
   my_bitmap_init(&handled_columns, buf, table->s->fields, FALSE);
 
+  /*
+    Selectivities of the conditions supported by indexes and of the
+    conditions over single columns, combined after both are found
+  */
+  double *cond_sels;
+  uint n_cond_sels= 0;
+  if (!(cond_sels= (double*) thd->alloc(sizeof(double) *
+                                        (table->s->keys + table->s->fields))))
+    DBUG_RETURN(TRUE);
+
   /*
     Calculate the selectivity of the range conditions supported by indexes.
 
@@ -3323,7 +3382,7 @@ bool calculate_cond_selectivity_for_table(THD *thd, TABLE *table, Item **cond)
             There is at least 1-column prefix of columns whose selectivity has
             not yet been accounted for.
           */
-          table->cond_selectivity*= quick_cond_selectivity;
+          double index_cond_selectivity= quick_cond_selectivity;
           Json_writer_object selectivity_for_index(thd);
           selectivity_for_index.add("index_name", key_info->name)
                                .add("selectivity_from_index",
@@ -3347,10 +3406,11 @@ bool calculate_cond_selectivity_for_table(THD *thd, TABLE *table, Item **cond)
               */
               selectivity_mult= ((double)(i+1)) / i;
             }
-            table->cond_selectivity*= selectivity_mult;
+            index_cond_selectivity*= selectivity_mult;
             selectivity_for_index.add("selectivity_multiplier",
                                       selectivity_mult);
           }
+          cond_sels[n_cond_sels++]= index_cond_selectivity;
           /*
             We need to set selectivity for fields supported by indexes.
             For single-component indexes and for some first components
@@ -3467,7 +3527,7 @@ bool calculate_cond_selectivity_for_table(THD *thd, TABLE *table, Item **cond)
           table_field->cond_selectivity < 1.0)
       {
         if (!bitmap_is_set(&handled_columns, table_field->field_index))
-          table->cond_selectivity*= table_field->cond_selectivity;
+          cond_sels[n_cond_sels++]= table_field->cond_selectivity;
       }
     }
 
@@ -3479,6 +3539,9 @@ bool calculate_cond_selectivity_for_table(THD *thd, TABLE *table, Item **cond)
   }
   selectivity_for_columns.end();
 
+  table->cond_selectivity*= combine_cond_selectivities(thd, cond_sels,
+                                                       n_cond_sels);
+
   if (quick && (quick->get_type() == QUICK_SELECT_I::QS_TYPE_ROR_UNION || 
      quick->get_type() == QUICK_SELECT_I::QS_TYPE_INDEX_MERGE))
   {
@@ -39,6 +39,7 @@ static int rr_quick(READ_RECORD *info);
 int rr_sequential(READ_RECORD *info);
 static int rr_from_tempfile(READ_RECORD *info);
 static int rr_unpack_from_tempfile(READ_RECORD *info);
+static int rr_unpack_packed_from_tempfile(READ_RECORD *info);
 static int rr_unpack_from_buffer(READ_RECORD *info);
 int rr_from_pointers(READ_RECORD *info);
 static int rr_from_cache(READ_RECORD *info);
@@ -228,8 +229,12 @@ bool init_read_record(READ_RECORD *info,THD *thd, TABLE *table,
   if (tempfile && !(select && select->quick))
   {
     DBUG_PRINT("info",("using rr_from_tempfile"));
-    info->read_record_func=
-        addon_field ? rr_unpack_from_tempfile : rr_from_tempfile;
+    if (!addon_field)
+      info->read_record_func= rr_from_tempfile;
+    else if (filesort->using_packed_addons)
+      info->read_record_func= rr_unpack_packed_from_tempfile;
+    else
+      info->read_record_func= rr_unpack_from_tempfile;
     info->io_cache= tempfile;
     reinit_io_cache(info->io_cache,READ_CACHE,0L,0,0);
     info->ref_pos=table->file->ref;
@@ -532,6 +537,32 @@ static int rr_unpack_from_tempfile(READ_RECORD *info)
   return 0;
 }
 
+
+/**
+  Read a result set record with packed addon fields from a temporary
+  file after sorting.
+
+  The same as rr_unpack_from_tempfile() but the length of the record
+  is read first.
+*/
+
+static int rr_unpack_packed_from_tempfile(READ_RECORD *info)
+{
+  uchar *buff= info->rec_buf;
+  uint length;
+  if (my_b_read(info->io_cache, buff, SORT_ADDON_LENGTH_BYTES))
+    return -1;
+  length= Sort_param::get_addon_length(buff);
+  DBUG_ASSERT(length >= SORT_ADDON_LENGTH_BYTES &&
+              length <= info->ref_length);
+  if (my_b_read(info->io_cache, buff + SORT_ADDON_LENGTH_BYTES,
+                length - SORT_ADDON_LENGTH_BYTES))
+    return -1;
+  (*info->unpack)(info->addon_field, buff, buff + length);
+
+  return 0;
+}
+
 int rr_from_pointers(READ_RECORD *info)
 {
   int tmp;
@@ -1715,6 +1715,7 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
   Query_cache_block *result_block;
   Query_cache_block_table *block_table, *block_table_end;
   size_t tot_length;
+  my_hash_value_type hash_value;
   Query_cache_query_flags flags;
   const char *sql, *sql_end, *found_brace= 0;
   DBUG_ENTER("Query_cache::send_result_to_client");
@@ -1873,22 +1874,10 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
     }
   }
   /*
-    Try to obtain an exclusive lock on the query cache. If the cache is
-    disabled or if a full cache flush is in progress, the attempt to
-    get the lock is aborted.
-
-    The TIMEOUT parameter indicate that the lock is allowed to timeout.
+    The key of the query in the hash is built and hashed before the query
+    cache is locked: it depends only on the query text and the state of
+    this connection, and the lock is held by one thread at a time.
   */
-  if (try_lock(thd, Query_cache::TIMEOUT))
-    goto err;
-
-  if (query_cache_size == 0)
-  {
-    thd->query_cache_is_applicable= 0;            // Query can't be cached
-    goto err_unlock;
-  }
-
-  Query_cache_block *query_block;
   if (thd->variables.query_cache_strip_comments)
   {
     if (found_brace)
@@ -1974,6 +1963,25 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
                           (int)flags.autocommit));
   memcpy((uchar *)(sql + (tot_length - QUERY_CACHE_FLAGS_SIZE)),
 	 (uchar*) &flags, QUERY_CACHE_FLAGS_SIZE);
+  hash_value= my_calc_hash(&queries, (uchar*) sql, tot_length);
+
+  /*
+    Try to obtain an exclusive lock on the query cache. If the cache is
+    disabled or if a full cache flush is in progress, the attempt to
+    get the lock is aborted.
+
+    The TIMEOUT parameter indicate that the lock is allowed to timeout.
+  */
+  if (try_lock(thd, Query_cache::TIMEOUT))
+    goto err;
+
+  if (query_cache_size == 0)
+  {
+    thd->query_cache_is_applicable= 0;            // Query can't be cached
+    goto err_unlock;
+  }
+
+  Query_cache_block *query_block;
 
 #ifdef WITH_WSREP
   bool once_more;
@@ -1981,8 +1989,9 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
 lookup:
 #endif /* WITH_WSREP */
 
-  query_block = (Query_cache_block *)  my_hash_search(&queries, (uchar*) sql,
-                                                      tot_length);
+  query_block= (Query_cache_block *)
+    my_hash_search_using_hash_value(&queries, hash_value, (uchar*) sql,
+                                    tot_length);
   /* Quick abort on unlocked data */
   if (query_block == 0 ||
       query_block->query()->result() == 0 ||
@@ -583,6 +583,7 @@ typedef struct system_variables
   sql_mode_t old_behavior; ///< which old SQL behaviour should be enabled
   ulonglong option_bits; ///< OPTION_xxx constants, e.g. OPTION_PROFILING
   ulonglong join_buff_space_limit;
+  ulonglong join_buff_hash_size_limit;
   ulonglong log_slow_filter; 
   ulonglong log_slow_verbosity; 
   ulonglong log_slow_disabled_statements;
@@ -642,6 +643,7 @@ typedef struct system_variables
   double sample_percentage;
   ulong histogram_size;
   ulong histogram_type;
+  ulong stat_tables_stale_percentage;
   ulong preload_buff_size;
   ulong profiling_history_size;
   ulong read_buff_size;
@@ -696,6 +698,8 @@ typedef struct system_variables
   my_bool big_tables;
   my_bool only_standard_compliant_cte;
   my_bool query_cache_strip_comments;
+  my_bool optimizer_reuse_join_order;
+  my_bool optimizer_selectivity_backoff;
   my_bool sql_log_slow;
   my_bool sql_log_bin;
   /*
@@ -840,6 +844,7 @@ typedef struct system_status_var
 
   ulong select_full_join_count_;
   ulong select_full_range_join_count_;
+  ulong select_join_order_reused_count_;
   ulong select_range_count_;
   ulong select_range_check_count_;
   ulong select_scan_count_;
@@ -5798,6 +5803,8 @@ class select_union_direct :public select_unit
   /* Number of rows limit + offset, @see select_union_direct::send_data() */
   ha_rows limit;
 
+  void init_offset_limit();
+
 public:
   /* Number of rows in the union */
   ha_rows send_records; 
@@ -5821,6 +5828,7 @@ class select_union_direct :public select_unit
   bool initialize_tables (JOIN *join);
   bool send_eof();
   bool flush() { return false; }
+  ha_rows rows_left();
   bool check_simple_select() const
   {
     /* Only called for top-level select_results, usually select_send */
@@ -623,6 +623,15 @@ void Explain_union::print_explain_json(Explain_query *query,
       writer->add_null();
   }
 
+  /* `r_iteration_rows` */
+  if (is_analyze && is_recursive_cte)
+  {
+    writer->add_member("r_iteration_rows").start_array();
+    for (size_t i= 0; i < rec_iteration_rows.elements(); i++)
+      writer->add_ull(rec_iteration_rows.at(i));
+    writer->end_array();
+  }
+
   writer->add_member("query_specifications").start_array();
 
   for (int i= 0; i < (int) union_members.elements(); i++)
@@ -380,6 +380,17 @@ class Explain_union : public Explain_node
   bool using_filesort;
   bool using_tmp;
   bool is_recursive_cte;
+
+  /*
+    ANALYZE: the number of rows produced by each iteration of the recursive
+    CTE (the first element is for the anchor part)
+  */
+  Dynamic_array<ha_rows> rec_iteration_rows;
+
+  void add_recursive_iteration(ha_rows rows)
+  {
+    rec_iteration_rows.append(rows);
+  }
   
   /*
     Explain data structure for "fake_select_lex" (i.e. for the degenerate
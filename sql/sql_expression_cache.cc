@@ -30,7 +30,8 @@
 #define EXPCACHE_MIN_HIT_RATE_FOR_MEM_TABLE  0.2
 /**
   Number of cache miss to check hit ratio (maximum cache performance
-  impact in the case when the cache is not applicable)
+  impact in the case when the cache is not applicable). The check is
+  repeated after every such number of misses.
 */
 #define EXPCACHE_CHECK_HIT_RATIO_AFTER 200
 
@@ -44,7 +45,7 @@ Expression_cache_tmptable::Expression_cache_tmptable(THD *thd,
                                                      List<Item> &dependants,
                                                      Item *value)
   :cache_table(NULL), table_thd(thd), tracker(NULL), items(dependants), val(value),
-   hit(0), miss(0), inited (0)
+   hit(0), miss(0), checked_hit(0), checked_miss(0), inited (0)
 {
   DBUG_ENTER("Expression_cache_tmptable::Expression_cache_tmptable");
   DBUG_VOID_RETURN;
@@ -67,6 +68,29 @@ void Expression_cache_tmptable::disable_cache()
 }
 
 
+/**
+  Check whether the cache is not worth keeping
+
+  @details
+  The hit ratio is calculated for the lookups done since the previous
+  check, so the cache is switched off also when it stops paying off in
+  the course of the query, e.g. when the outer rows come to contain
+  mostly new parameter values.
+
+  @retval TRUE  the hit ratio is too low to keep the cache
+  @retval FALSE otherwise
+*/
+
+bool Expression_cache_tmptable::is_hit_ratio_low()
+{
+  double hits= (double) (hit - checked_hit);
+  double misses= (double) (miss - checked_miss);
+  checked_hit= hit;
+  checked_miss= miss;
+  return hits / (hits + misses) < EXPCACHE_MIN_HIT_RATE_FOR_MEM_TABLE;
+}
+
+
 /**
   Field enumerator for TABLE::add_tmp_key
 
@@ -223,12 +247,11 @@ Expression_cache::result Expression_cache_tmptable::check_value(Item **value)
 
     if (res)
     {
-      if (((++miss) == EXPCACHE_CHECK_HIT_RATIO_AFTER) &&
-          ((double)hit / ((double)hit + miss)) <
-          EXPCACHE_MIN_HIT_RATE_FOR_MEM_TABLE)
+      if (((++miss) % EXPCACHE_CHECK_HIT_RATIO_AFTER) == 0 &&
+          is_hit_ratio_low())
       {
         DBUG_PRINT("info",
-                   ("Early check: hit rate is not so good to keep the cache"));
+                   ("Periodic check: hit rate is not so good to keep the cache"));
         disable_cache();
       }
 
@@ -133,6 +133,7 @@ class Expression_cache_tmptable :public Expression_cache
 
 private:
   void disable_cache();
+  bool is_hit_ratio_low();
 
   /* tmp table parameters */
   TMP_TABLE_PARAM cache_table_param;
@@ -152,6 +153,8 @@ class Expression_cache_tmptable :public Expression_cache
   Item *val;
   /* hit/miss counters */
   ulong hit, miss;
+  /* hit/miss counters at the last check of the hit ratio */
+  ulong checked_hit, checked_miss;
   /* Set on if the object has been succesfully initialized with init() */
   bool inited;
 };
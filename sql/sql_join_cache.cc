@@ -696,8 +696,14 @@ void JOIN_CACHE::set_constants()
   pack_length_with_blob_ptrs= pack_length + blobs*sizeof(uchar *);
   min_buff_size= 0;
   min_records= 1;
-  buff_size= (size_t)MY_MAX(join->thd->variables.join_buff_size,
-                 get_min_join_buffer_size());
+  /*
+    The offsets stored in the buffer must be wide enough for any size
+    up to which the buffer may grow beyond join_buffer_size.
+  */
+  size_t limit_sz= (size_t) join->thd->variables.join_buff_size;
+  if (optimizer_flag(join->thd, OPTIMIZER_SWITCH_OPTIMIZE_JOIN_BUFFER_SIZE))
+    set_if_bigger(limit_sz, get_max_grown_join_buffer_size());
+  buff_size= MY_MAX(limit_sz, get_min_join_buffer_size());
   size_of_rec_ofs= offset_size(buff_size);
   size_of_rec_len= blobs ? size_of_rec_ofs : offset_size(len); 
   size_of_fld_ofs= size_of_rec_len;
@@ -812,7 +818,9 @@ size_t JOIN_CACHE::get_min_join_buffer_size()
     partial join that joins tables from the first one through join_tab. This
     value is also capped off by the value of join_tab->join_buffer_size_limit,
     if it has been set a to non-zero value, and by the value of the system
-    parameter join_buffer_size - otherwise. After the calculation of the
+    parameter join_buffer_size - otherwise. If optimize_buff_size is true
+    the system parameter join_buffer_size can be exceeded up to the value
+    returned by get_max_grown_join_buffer_size(). After the calculation of the
     interesting size the function saves the value in the field 'max_buff_size'
     in order to use it directly at the next  invocations of the function.
 
@@ -842,6 +850,8 @@ size_t JOIN_CACHE::get_max_join_buffer_size(bool optimize_buff_size)
     space_per_record= len;
     
     size_t limit_sz= (size_t)join->thd->variables.join_buff_size;
+    if (optimize_buff_size)
+      set_if_bigger(limit_sz, get_max_grown_join_buffer_size());
     if (join_tab->join_buffer_size_limit)
       set_if_smaller(limit_sz, join_tab->join_buffer_size_limit);
     if (!optimize_buff_size)
@@ -2416,6 +2426,111 @@ enum_nested_loop_state JOIN_CACHE::generate_full_extensions(uchar *rec_ptr)
 }
 
 
+/*
+  Order the conjuncts of the pushdown condition for join_tab
+
+  SYNOPSIS
+    order_cond_conjuncts()
+      cond        the pushdown condition join_tab->select->cond
+
+  DESCRIPTION
+    The pushdown condition of join_tab is checked for every candidate record
+    from the join buffer. If the condition is a conjunction where some of
+    the expensive conjuncts (e.g. subqueries or stored function calls)
+    precede cheap ones the function builds the array cond_conjuncts where
+    all cheap conjuncts go first while the relative order of the conjuncts
+    in each of the two groups is preserved. Thus the expensive conjuncts are
+    evaluated only for the records that have passed all cheap ones.
+    If no conjunct has to be moved cond_conjuncts is set to NULL.
+    In any case ordered_cond is set to cond.
+
+  RETURN VALUE
+    none
+*/ 
+
+void JOIN_CACHE::order_cond_conjuncts(Item *cond)
+{
+  ordered_cond= cond;
+  cond_conjuncts= 0;
+  if (!is_cond_and(cond))
+    return;
+
+  List<Item> *args= ((Item_cond *) cond)->argument_list();
+  List_iterator_fast<Item> li(*args);
+  Item *item;
+  bool expensive_found= FALSE;
+  bool reorder= FALSE;
+  while ((item= li++))
+  {
+    if (item->is_expensive())
+      expensive_found= TRUE;
+    else if (expensive_found)
+      reorder= TRUE;
+  }
+  if (!reorder ||
+      !(cond_conjuncts= (Item **) join->thd->alloc(sizeof(Item *) *
+                                                   (args->elements + 1))))
+    return;
+
+  Item **ptr= cond_conjuncts;
+  for (uint expensive= 0; expensive < 2; expensive++)
+  {
+    li.rewind();
+    while ((item= li++))
+    {
+      if (item->is_expensive() == MY_TEST(expensive))
+        *ptr++= item;
+    }
+  }
+  *ptr= 0;
+}
+
+
+/*
+  Check the pushdown condition for join_tab
+
+  SYNOPSIS
+    check_pushdown_cond()
+
+  DESCRIPTION
+    The function checks whether the current record of join_tab extended
+    by the partial join record read from the join buffer satisfies the
+    condition pushed to join_tab. It is equivalent to
+    join_tab->select->skip_record() except that the conjuncts of the
+    condition are evaluated in the order set by order_cond_conjuncts()
+    and the evaluation stops at the first conjunct that is not true.
+
+  RETURN VALUE
+    1   the condition is satisfied
+    0   the condition is not satisfied
+   -1   an error occurred
+*/ 
+
+int JOIN_CACHE::check_pushdown_cond()
+{
+  SQL_SELECT *select= join_tab->select;
+  if (!select->cond)
+    return 1;
+  if (select->cond != ordered_cond)
+    order_cond_conjuncts(select->cond);
+  if (!cond_conjuncts)
+    return select->skip_record(join->thd);
+
+  int rc= 1;
+  for (Item **item= cond_conjuncts; *item; item++)
+  {
+    if (!(*item)->val_bool())
+    {
+      rc= 0;
+      break;
+    }
+  }
+  if (join->thd->is_error())
+    rc= -1;
+  return rc;
+}
+
+
 /*
   Check matching to a partial join record from the join buffer    
 
@@ -2446,7 +2561,7 @@ inline bool JOIN_CACHE::check_match(uchar *rec_ptr)
   /* Check whether pushdown conditions are satisfied */
   DBUG_ENTER("JOIN_CACHE:check_match");
 
-  if (join_tab->select && join_tab->select->skip_record(join->thd) <= 0)
+  if (join_tab->select && check_pushdown_cond() <= 0)
     DBUG_RETURN(FALSE);
   
   join_tab->jbuf_tracker->r_rows_after_where++;
@@ -2694,7 +2809,7 @@ int JOIN_CACHE_HASHED::init(bool for_explain)
   ref_key_info= join_tab->get_keyinfo_by_key_no(join_tab->ref.key);
   ref_used_key_parts= join_tab->ref.key_parts;
 
-  hash_func= &JOIN_CACHE_HASHED::get_hash_idx_simple;
+  hash_func= &JOIN_CACHE_HASHED::get_hash_simple;
   hash_cmp_func= &JOIN_CACHE_HASHED::equal_keys_simple;
 
   KEY_PART_INFO *key_part= ref_key_info->key_part;
@@ -2703,7 +2818,7 @@ int JOIN_CACHE_HASHED::init(bool for_explain)
   {
     if (!key_part->field->eq_cmp_as_binary())
     {
-      hash_func= &JOIN_CACHE_HASHED::get_hash_idx_complex;
+      hash_func= &JOIN_CACHE_HASHED::get_hash_complex;
       hash_cmp_func= &JOIN_CACHE_HASHED::equal_keys_complex;
       break;
     }
@@ -2735,8 +2850,8 @@ int JOIN_CACHE_HASHED::init(bool for_explain)
 
   DESCRIPTION
     The function estimates the number of hash table entries in the hash
-    table to be used and initializes this hash table within the join buffer
-    space.
+    table to be used and initializes this hash table together with the
+    key filter following it within the join buffer space.
 
   RETURN VALUE
     Currently the function always returns 0;
@@ -2757,9 +2872,10 @@ int JOIN_CACHE_HASHED::init_hash_table()
                       size_of_key_ofs +          // reference to the next key 
                       (use_emb_key ?  get_size_of_rec_offset() : key_length);
 
+    /* Each hash entry is accompanied by one byte of the key filter */
     size_t space_per_rec= avg_record_length +
                          avg_aux_buffer_incr +
-                         key_entry_length+size_of_key_ofs;
+                         key_entry_length+size_of_key_ofs+1;
     size_t n= buff_size / space_per_rec;
 
     /*
@@ -2767,7 +2883,7 @@ int JOIN_CACHE_HASHED::init_hash_table()
             the number of records in in the join buffer.
     */
     size_t max_n= buff_size / (pack_length-length+
-                             key_entry_length+size_of_key_ofs);
+                             key_entry_length+size_of_key_ofs+1);
 
     hash_entries= (uint) (n / 0.7);
     set_if_bigger(hash_entries, 1);
@@ -2778,7 +2894,8 @@ int JOIN_CACHE_HASHED::init_hash_table()
   }
    
   /* Initialize the hash table */ 
-  hash_table= buff + (buff_size-hash_entries*size_of_key_ofs);
+  hash_table= buff + (buff_size-hash_entries*(size_of_key_ofs+1));
+  key_filter= hash_table + hash_entries*size_of_key_ofs;
   cleanup_hash_table();
   curr_key_entry= hash_table;
 
@@ -2825,7 +2942,7 @@ int JOIN_CACHE_HASHED::realloc_buffer()
   
   DESCRIPTION
     The function returns the size of the space occupied by one key entry
-    and one hash table entry.
+    and one hash table entry together with its byte of the key filter.
 
   RETURN VALUE
     maximum size of the additional space per record that is used to store
@@ -2844,11 +2961,38 @@ uint JOIN_CACHE_HASHED::get_max_key_addon_space_per_record()
   len= (use_emb_key ?  get_size_of_rec_offset() : ref->key_length) +
         size_of_rec_ofs +    // size of the key chain header
         size_of_rec_ofs +    // >= size of the reference to the next key 
-        2*size_of_rec_ofs;   // >= 2*( size of hash table entry)
+        2*size_of_rec_ofs +  // >= 2*( size of hash table entry)
+        2;                   // >= 2*( size of key filter entry)
   return len; 
 }    
 
 
+/*
+  Get the size up to which the buffer of a hashed join cache may grow
+
+  SYNOPSIS
+    get_max_grown_join_buffer_size()
+
+  DESCRIPTION
+    Each refill of a hashed join buffer requires a new scan of join_tab
+    (BNLH) or a new batch of key lookups into it (BKAH). If the records
+    of the partial join are not expected to fit into a buffer of the size
+    join_buffer_size the function allows the buffer to take up to
+    join_buffer_hash_size_limit bytes, so that all of them could be hashed
+    at once. The total size of all join buffers remains limited by
+    join_buffer_space_limit.
+
+  RETURN VALUE
+    The value of the system parameter join_buffer_hash_size_limit
+*/
+
+size_t JOIN_CACHE_HASHED::get_max_grown_join_buffer_size()
+{
+  ulonglong limit_sz= join->thd->variables.join_buff_hash_size_limit;
+  return (size_t) MY_MIN(limit_sz, SIZE_T_MAX);
+}
+
+
 /* 
   Reset the buffer of a hashed join cache for reading/writing
 
@@ -2912,6 +3056,7 @@ bool JOIN_CACHE_HASHED::put_record()
   uchar *link= 0;
   TABLE_REF *ref= &join_tab->ref;
   uchar *next_ref_ptr= pos;
+  ulong hash;
 
   pos+= get_size_of_rec_offset();
   /* Write the record into the join buffer */  
@@ -2932,7 +3077,8 @@ bool JOIN_CACHE_HASHED::put_record()
   }
 
   /* Look for the key in the hash table */
-  if (key_search(key, key_len, &key_ref_ptr))
+  hash= get_key_hash(key, key_len);
+  if (key_search(key, key_len, hash, &key_ref_ptr))
   {
     uchar *last_next_ref_ptr;
     /* 
@@ -2976,6 +3122,9 @@ bool JOIN_CACHE_HASHED::put_record()
     }
     last_key_entry= cp;
     DBUG_ASSERT(last_key_entry >= end_pos);
+    /* Add the key to the key filter */
+    ulong bit= get_key_filter_bit(hash);
+    key_filter[bit / 8]|= (uchar) (1 << (bit % 8));
     /* Increment the counter of key_entries in the hash table */ 
     key_entries++;
   }  
@@ -3071,6 +3220,7 @@ bool JOIN_CACHE_HASHED::skip_if_not_needed_match()
     key_search()
       key             pointer to the key value
       key_len         key value length
+      hash            hash value of the key
       key_ref_ptr OUT position of the reference to the next key from 
                       the hash element for the found key , or
                       a position where the reference to the the hash 
@@ -3089,11 +3239,11 @@ bool JOIN_CACHE_HASHED::skip_if_not_needed_match()
     FALSE   otherwise
 */
 
-bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len,
+bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len, ulong hash,
                                    uchar **key_ref_ptr) 
 {
   bool is_found= FALSE;
-  uint idx= (this->*hash_func)(key, key_length);
+  uint idx= (uint) (hash % hash_entries);
   uchar *ref_ptr= hash_table+size_of_key_ofs*idx;
   while (!is_null_key_ref(ref_ptr))
   {
@@ -3117,21 +3267,22 @@ bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len,
   Hash function that considers a key in the hash table as byte array
 
   SYNOPSIS
-    get_hash_idx_simple()
+    get_hash_simple()
       key             pointer to the key value
       key_len         key value length
       
   DESCRIPTION
-    The function calculates an index of the hash entry in the hash table
-    of the join buffer for the given key. It considers the key just as
-    a sequence of bytes of the length key_len.
+    The function calculates the hash value for the given key. The index of
+    the hash entry in the hash table of the join buffer and the bit of the
+    key filter for the key are taken from this value. The function considers
+    the key just as a sequence of bytes of the length key_len.
 
   RETURN VALUE
-    the calculated index of the hash entry for the given key  
+    the calculated hash value for the given key  
 */
 
 inline
-uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
+ulong JOIN_CACHE_HASHED::get_hash_simple(uchar* key, uint key_len)
 {
   ulong nr= 1;
   ulong nr2= 4;
@@ -3142,7 +3293,7 @@ uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
     nr^= (ulong) ((((uint) nr & 63)+nr2)*((uint) *pos))+ (nr << 8);
     nr2+= 3;
   }
-  return nr % hash_entries;
+  return nr;
 }
 
 
@@ -3150,13 +3301,14 @@ uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
   Hash function that takes into account collations of the components of the key  
 
   SYNOPSIS
-    get_hash_idx_complex()
+    get_hash_complex()
       key             pointer to the key value
       key_len         key value length
       
   DESCRIPTION
-    The function calculates an index of the hash entry in the hash table
-    of the join buffer for the given key. It takes into account that the
+    The function calculates the hash value for the given key that is used
+    to find the hash entry in the hash table of the join buffer and the bit
+    of the key filter for the key. It takes into account that the
     components of the key may be of a varchar type with different collations.
     The function guarantees that the same hash value for any two equal
     keys that may differ as byte sequences.
@@ -3166,14 +3318,13 @@ uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
     operation.
 
   RETURN VALUE
-    the calculated index of the hash entry for the given key  
+    the calculated hash value for the given key  
 */
 
 inline
-uint JOIN_CACHE_HASHED::get_hash_idx_complex(uchar *key, uint key_len)
+ulong JOIN_CACHE_HASHED::get_hash_complex(uchar *key, uint key_len)
 {
-  return 
-    (uint) (key_hashnr(ref_key_info, ref_used_key_parts, key) % hash_entries);
+  return key_hashnr(ref_key_info, ref_used_key_parts, key);
 }
 
 
@@ -3652,8 +3803,13 @@ uchar *JOIN_CACHE_BNLH::get_matching_chain_by_join_key()
   KEY *keyinfo= join_tab->get_keyinfo_by_key_no(ref->key);
   /* Build the join key value out of the record in the record buffer */
   key_copy(key_buff, table->record[0], keyinfo, key_length, TRUE);
-  /* Look for this key in the join buffer */
-  if (!key_search(key_buff, key_length, &key_ref_ptr))
+  /*
+    Look for this key in the join buffer, skipping the search in the hash
+    table if the key filter shows that the key is not there
+  */
+  ulong hash= get_key_hash(key_buff, key_length);
+  if (!key_filter_may_contain(hash) ||
+      !key_search(key_buff, key_length, hash, &key_ref_ptr))
     return 0;
   return key_ref_ptr+get_size_of_key_offset();
 }
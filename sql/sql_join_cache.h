@@ -249,6 +249,18 @@ class JOIN_CACHE :public Sql_alloc
   /* Expected join buffer space used for one record */
   size_t space_per_record; 
 
+  /* 
+    The condition join_tab->select->cond for which the array cond_conjuncts
+    has been built
+  */
+  Item *ordered_cond;
+  /*
+    NULL-terminated array of the conjuncts of ordered_cond where the expensive
+    conjuncts follow the cheap ones, or NULL if ordered_cond is to be checked
+    as is (see check_pushdown_cond())
+  */
+  Item **cond_conjuncts;
+
   /* Pointer to the beginning of the join buffer */
   uchar *buff;         
   /* 
@@ -526,6 +538,12 @@ class JOIN_CACHE :public Sql_alloc
 
   enum_nested_loop_state generate_full_extensions(uchar *rec_ptr);
 
+  /* Order the conjuncts of the pushdown condition to be checked cheap first */
+  void order_cond_conjuncts(Item *cond);
+
+  /* Check the pushdown condition for join_tab */
+  int check_pushdown_cond();
+
   /* Check matching to a partial join record from the join buffer */
   bool check_match(uchar *rec_ptr);
 
@@ -540,6 +558,8 @@ class JOIN_CACHE :public Sql_alloc
     join_tab= tab;
     prev_cache= next_cache= 0;
     buff= 0;
+    ordered_cond= 0;
+    cond_conjuncts= 0;
   }
 
   /* 
@@ -555,6 +575,8 @@ class JOIN_CACHE :public Sql_alloc
     next_cache= 0;
     prev_cache= prev;
     buff= 0;
+    ordered_cond= 0;
+    cond_conjuncts= 0;
     if (prev)
       prev->next_cache= this;
   }
@@ -609,6 +631,11 @@ class JOIN_CACHE :public Sql_alloc
   virtual size_t get_min_join_buffer_size();
   /* Get the maximum possible size of the cache join buffer */ 
   virtual size_t get_max_join_buffer_size(bool optimize_buff_size);
+  /* 
+    Get the size up to which the join buffer may grow beyond join_buffer_size
+    when it is expected to be too small for all records of the partial join
+  */
+  virtual size_t get_max_grown_join_buffer_size() { return 0; }
 
   /* Shrink the size if the cache join buffer in a given ratio */
   bool shrink_join_buffer_in_ratio(ulonglong n, ulonglong d);
@@ -696,7 +723,10 @@ class JOIN_CACHE :public Sql_alloc
   To build the chains with the same keys a hash table is employed. It is placed
   at the very end of the join buffer. The array of hash entries is allocated
   first at the very bottom of the join buffer, while key entries are placed
-  before this array.
+  before this array. The hash table is followed by a key filter: a bitmap
+  with 8 bits per hash entry where a bit is set for the hash value of each
+  key stored in the hash table. Probes with keys whose bits are not set
+  are rejected without touching the hash table.
   A hash entry contains a header of the list of the key entries with the same
   hash value. 
   Each key entry is a structure of the following type:
@@ -763,7 +793,7 @@ class JOIN_CACHE :public Sql_alloc
 class JOIN_CACHE_HASHED: public JOIN_CACHE
 {
 
-  typedef uint (JOIN_CACHE_HASHED::*Hash_func) (uchar *key, uint key_len);
+  typedef ulong (JOIN_CACHE_HASHED::*Hash_func) (uchar *key, uint key_len);
   typedef bool (JOIN_CACHE_HASHED::*Hash_cmp_func) (uchar *key1, uchar *key2,
                                                     uint key_len);
   
@@ -784,6 +814,9 @@ class JOIN_CACHE_HASHED: public JOIN_CACHE
   /* Number of hash entries in the hash table */
   uint hash_entries;
 
+  /* The filter of the keys in the hash table, placed right after it */
+  uchar *key_filter;
+
 
   /* The position of the currently retrieved key entry in the hash table */
   uchar *curr_key_entry;
@@ -791,8 +824,14 @@ class JOIN_CACHE_HASHED: public JOIN_CACHE
   /* The offset of the data fields from the beginning of the record fields */
   uint data_fields_offset;
 
-  inline uint get_hash_idx_simple(uchar *key, uint key_len);
-  inline uint get_hash_idx_complex(uchar *key, uint key_len);
+  inline ulong get_hash_simple(uchar *key, uint key_len);
+  inline ulong get_hash_complex(uchar *key, uint key_len);
+
+  /* The number of the bit for the hash value in the key filter */
+  ulong get_key_filter_bit(ulong hash)
+  {
+    return hash % ((ulong) hash_entries * 8);
+  }
 
   inline bool equal_keys_simple(uchar *key1, uchar *key2, uint key_len);
   inline bool equal_keys_complex(uchar *key1, uchar *key2, uint key_len);
@@ -969,12 +1008,28 @@ class JOIN_CACHE_HASHED: public JOIN_CACHE
   */
   bool skip_if_not_needed_match();
 
-  /* Search for a key in the hash table of the join buffer */
-  bool key_search(uchar *key, uint key_len, uchar **key_ref_ptr);
+  /* Get the hash value of a key */
+  ulong get_key_hash(uchar *key, uint key_len)
+  {
+    return (this->*hash_func)(key, key_len);
+  }
+
+  /* Search for a key with the given hash value in the hash table */
+  bool key_search(uchar *key, uint key_len, ulong hash, uchar **key_ref_ptr);
+
+  /* Check whether a key with the given hash value may be in the hash table */
+  bool key_filter_may_contain(ulong hash)
+  {
+    ulong bit= get_key_filter_bit(hash);
+    return MY_TEST(key_filter[bit / 8] & (1 << (bit % 8)));
+  }
 
   /* Reallocate the join buffer of a hashed join cache */
   int realloc_buffer();
 
+  /* Get the size up to which the hashed join buffer may grow */
+  size_t get_max_grown_join_buffer_size();
+
   /* 
     This constructor creates an unlinked hashed join cache. The cache is to be
     used to join table 'tab' to the result of joining the previous tables 
@@ -812,6 +812,7 @@ typedef class st_select_lex_node SELECT_LEX_NODE;
 class THD;
 class select_result;
 class JOIN;
+struct st_saved_join_order;
 class select_unit;
 class Procedure;
 class Explain_query;
@@ -1095,6 +1096,8 @@ class st_select_lex: public st_select_lex_node
   */
   List<Item_sum> min_max_opt_list;
   JOIN *join; /* after JOIN::prepare it is pointer to corresponding JOIN */
+  /* join order reused by the executions of a prepared statement */
+  st_saved_join_order *saved_join_order;
   List<TABLE_LIST> top_join_list; /* join list of the top level          */
   List<TABLE_LIST> *join_list;    /* list for the currently parsed join  */
   TABLE_LIST *embedding;          /* table embedding to the above list   */
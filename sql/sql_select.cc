@@ -112,6 +112,9 @@ void best_access_path(JOIN *join, JOIN_TAB *s,
                              bool disable_jbuf, double record_count,
                              POSITION *pos, POSITION *loose_scan_pos);
 static void optimize_straight_join(JOIN *join, table_map join_tables);
+static bool reuse_saved_join_order(JOIN *join, table_map join_tables);
+static void save_join_order(JOIN *join);
+static void check_saved_join_order(JOIN *join);
 static bool greedy_search(JOIN *join, table_map remaining_tables,
                           uint depth, uint prune_level,
                           uint use_cond_selectivity);
@@ -3594,9 +3597,20 @@ bool JOIN::make_aggr_tables_info()
           "select SQL_CALC_FOUND_ROWS * from t1 order by b desc limit 1;"
         m_select_limit == HA_POS_ERROR (we need a full table scan)
         unit->select_limit_cnt == 1 (we only need one row in the result set)
+        The same holds for the last temporary table holding the already
+        grouped rows when nothing filters or removes the sorted rows
+        before they are sent:
+          "select a, sum(b) from t1 group by a having sum(b) > 10
+           order by 2 limit 10"
       */
+      bool sort_final_rows= (need_tmp && !group && !having &&
+                             sort_tab >= join_tab + top_join_tab_count &&
+                             !sort_tab->distinct &&
+                             !select_lex->have_window_funcs() &&
+                             rollup.state == ROLLUP::STATE_NONE);
       sort_tab->filesort->limit=
-        (has_group_by || (join_tab + table_count > curr_tab + 1)) ?
+        ((has_group_by && !sort_final_rows) ||
+         (join_tab + table_count > curr_tab + 1)) ?
          select_limit : unit->select_limit_cnt;
     }
     if (!only_const_tables() &&
@@ -4172,6 +4186,9 @@ void JOIN::exec()
   exec_inner();
   ANALYZE_STOP_TRACKING(&explain->time_tracker);
 
+  if (select_lex->saved_join_order)
+    check_saved_join_order(this);
+
   DBUG_EXECUTE_IF("show_explain_probe_join_exec_end", 
                   if (dbug_user_var_equals_int(thd, 
                                                "show_explain_probe_select_id", 
@@ -5309,6 +5326,15 @@ make_join_statistics(JOIN *join, List<TABLE_LIST> &tables_list,
                                         "system");
         continue;
       }
+      if (s->table->stale_stat_records)
+      {
+        Json_writer_object table_records(thd);
+        table_records.add_table_name(s);
+        Json_writer_object trace_stale(thd, "stat_tables_out_of_date");
+        trace_stale.add("rows_in_stat_tables",
+                        s->table->s->stats_cb.table_stats->cardinality)
+                   .add("rows_from_engine", s->table->stat_records());
+      }
       /* Approximate found rows and time to read them */
       if (s->table->is_filled_at_execution())
       {
@@ -5475,10 +5501,12 @@ make_join_statistics(JOIN *join, List<TABLE_LIST> &tables_list,
     SELECT_LEX_UNIT *unit= join->select_lex->master_unit();
 
     /* Find an optimal join order of the non-constant tables. */
-    if (join->const_tables != join->table_count)
+    if (join->const_tables != join->table_count &&
+        !reuse_saved_join_order(join, all_table_map & ~join->const_table_map))
     {
       if (choose_plan(join, all_table_map & ~join->const_table_map))
         goto error;
+      save_join_order(join);
     }
     else
     {
@@ -8144,6 +8172,188 @@ choose_plan(JOIN *join, table_map join_tables)
 }
 
 
+/*
+  Check whether the join order of a join can be saved for the following
+  executions of the statement
+*/
+
+static bool join_order_can_be_saved(JOIN *join)
+{
+  THD *thd= join->thd;
+  if (!thd->variables.optimizer_reuse_join_order ||
+      thd->stmt_arena->is_conventional() ||
+      (join->select_options & SELECT_STRAIGHT_JOIN) ||
+      join->emb_sjm_nest || join->select_lex->sj_nests.elements)
+    return FALSE;
+
+  /*
+    Only base tables are considered: the TABLE_LIST objects of them stay
+    the same in all executions of the statement.
+  */
+  for (uint i= join->const_tables; i < join->table_count; i++)
+  {
+    TABLE_LIST *tbl= join->best_ref[i]->table->pos_in_table_list;
+    if (!tbl || tbl->jtbm_subselect ||
+        join->best_ref[i]->table->s->tmp_table != NO_TMP_TABLE)
+      return FALSE;
+  }
+  return TRUE;
+}
+
+
+/*
+  Save the join order chosen for a join in its SELECT_LEX
+
+  @details
+    The order is saved on the memory root of the prepared statement
+    (or of the stored routine statement), so that the following executions
+    of it could use it instead of searching for a join order again.
+    See reuse_saved_join_order().
+*/
+
+static void save_join_order(JOIN *join)
+{
+  SELECT_LEX *select= join->select_lex;
+  st_saved_join_order *saved= select->saved_join_order;
+  uint tables= join->table_count - join->const_tables;
+
+  if (!join_order_can_be_saved(join))
+    return;
+
+  if (!saved || saved->size < tables)
+  {
+    Query_arena *arena= join->thd->stmt_arena;
+    if (!(saved= (st_saved_join_order*)
+                 arena->alloc(sizeof(st_saved_join_order))) ||
+        !(saved->order= (TABLE_LIST**) arena->alloc(sizeof(TABLE_LIST*) *
+                                                    tables)) ||
+        !(saved->versions= (ulong*) arena->alloc(sizeof(ulong) * tables)))
+      return;
+    saved->size= tables;
+    saved->tables= 0;
+    saved->reoptimize= saved->keep= FALSE;
+    select->saved_join_order= saved;
+  }
+
+  /*
+    If the order has been searched for again because of bad estimates and
+    the same order has been found, the estimates are not better with any
+    other order: do not drop the order for them any more.
+  */
+  bool same_order= saved->reoptimize && saved->tables == tables;
+  for (uint i= 0; i < tables; i++)
+  {
+    TABLE *table= join->best_positions[join->const_tables + i].table->table;
+    same_order&= saved->order[i] == table->pos_in_table_list;
+    saved->order[i]= table->pos_in_table_list;
+    saved->versions[i]= table->s->get_table_def_version();
+  }
+  saved->tables= tables;
+  if (same_order)
+    saved->keep= TRUE;
+  saved->reoptimize= FALSE;
+}
+
+
+/*
+  Build the query plan of a join using the join order saved by a previous
+  execution of the statement
+
+  @details
+    The saved join order is used if the set of the non-constant tables of
+    the join is the same as when the order was saved, and the definitions
+    of the tables have not been reloaded since then (as it happens e.g.
+    after ANALYZE TABLE). The tables are joined in the saved order and only
+    the access methods for them are chosen again, as it is done for
+    STRAIGHT_JOIN.
+
+  @retval TRUE   the plan has been built with the saved join order
+  @retval FALSE  otherwise, the join order is to be searched for
+*/
+
+static bool reuse_saved_join_order(JOIN *join, table_map join_tables)
+{
+  st_saved_join_order *saved= join->select_lex->saved_join_order;
+  uint tables= join->table_count - join->const_tables;
+  JOIN_TAB **ref= join->best_ref + join->const_tables;
+  THD *thd= join->thd;
+  DBUG_ENTER("reuse_saved_join_order");
+
+  if (!saved || saved->reoptimize || saved->tables != tables ||
+      !join_order_can_be_saved(join))
+    DBUG_RETURN(FALSE);
+
+  /* Put the tables into best_ref in the saved order */
+  for (uint i= 0; i < tables; i++)
+  {
+    TABLE_LIST *tbl= saved->order[i];
+    JOIN_TAB **pos;
+    for (pos= ref + i;
+         pos < ref + tables && (*pos)->table->pos_in_table_list != tbl;
+         pos++)
+    {}
+    if (pos == ref + tables ||
+        (*pos)->table->s->get_table_def_version() != saved->versions[i])
+      DBUG_RETURN(FALSE);
+    swap_variables(JOIN_TAB*, ref[i], *pos);
+  }
+
+  join->cur_embedding_map= 0;
+  reset_nj_counters(join, join->join_list);
+  join->cur_sj_inner_tables= 0;
+  {
+    Json_writer_object wrapper(thd);
+    Json_writer_array trace_plan(thd, "considered_execution_plans");
+    optimize_straight_join(join, join_tables);
+  }
+  if (thd->lex->is_single_level_stmt())
+    thd->status_var.last_query_cost= join->best_read;
+  status_var_increment(thd->status_var.select_join_order_reused_count_);
+  DBUG_RETURN(TRUE);
+}
+
+
+/*
+  Drop the saved join order of a join if it has been executed with row
+  counts far above the estimates
+
+  @details
+    The join order is saved by the first execution of a statement and is
+    reused by the following ones, which may have parameter values with very
+    different cardinalities. After each execution the number of rows
+    actually read per scan of a table, as counted by its access tracker, is
+    compared with the number of rows the plan expected. If some table has
+    read SAVED_JOIN_ORDER_MAX_ROWS_RATIO times more rows, the saved order is
+    dropped, so that the next execution searches for a join order for its
+    own parameters. Reading fewer rows than expected is not taken into
+    account, as the execution may stop early because of a LIMIT.
+    If that search gives the same order again, the order is kept from then
+    on (see save_join_order()).
+*/
+
+static void check_saved_join_order(JOIN *join)
+{
+  st_saved_join_order *saved= join->select_lex->saved_join_order;
+  if (!saved->tables || saved->reoptimize || saved->keep || !join->join_tab)
+    return;
+
+  for (JOIN_TAB *tab= join->join_tab + join->const_tables;
+       tab < join->join_tab + join->top_join_tab_count;
+       tab++)
+  {
+    if (!tab->tracker || !tab->tracker->has_scans())
+      continue;
+    double estimate= MY_MAX((double) tab->get_examined_rows(), 1.0);
+    if (tab->tracker->get_avg_rows() >
+        estimate * SAVED_JOIN_ORDER_MAX_ROWS_RATIO)
+    {
+      saved->reoptimize= TRUE;
+      return;
+    }
+  }
+}
+
+
 /*
   Compare two join tabs based on the subqueries they are from.
    - top-level join tabs go first
@@ -17956,6 +18166,12 @@ TABLE *Create_tmp_table::start(THD *thd,
   bzero((char*) reg_field, sizeof(Field*) * (field_count+1));
   bzero((char*) m_default_field, sizeof(Field*) * (field_count));
   bzero((char*) m_from_field, sizeof(Field*) * field_count);
+  /*
+    end_update() compares group keys with memcmp(), so the bytes that the
+    key fields do not write (NULL values, VARCHAR tails) must be set
+  */
+  if (m_group && !m_using_unique_constraint)
+    bzero(m_group_buff, param->group_length);
 
   table->mem_root= own_root;
   mem_root_save= thd->mem_root;
@@ -21643,6 +21859,8 @@ end_update(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
 	   bool end_of_records)
 {
   TABLE *const table= join_tab->table;
+  AGGR_OP *const aggr= join_tab->aggr;
+  TMP_TABLE_PARAM *const param= join_tab->tmp_table_param;
   ORDER   *group;
   int	  error;
   DBUG_ENTER("end_update");
@@ -21670,12 +21888,24 @@ end_update(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
     if (item->maybe_null)
       group->buff[-1]= (char) group->field->is_null();
   }
+  if (aggr->last_group_positioned &&
+      !memcmp(aggr->last_group_key, param->group_buff, param->group_length))
+  {
+    /*
+      The row belongs to the same group as the previous one. The tmp table
+      is still positioned at the row of this group, so update it without
+      looking it up again.
+    */
+    restore_record(table,record[1]);
+    goto update;
+  }
   if (!table->file->ha_index_read_map(table->record[1],
-                                      join_tab->tmp_table_param->group_buff,
+                                      param->group_buff,
                                       HA_WHOLE_KEY,
                                       HA_READ_KEY_EXACT))
   {						/* Update old record */
     restore_record(table,record[1]);
+update:
     update_tmptable_sum_func(join->sum_funcs,table);
     if (unlikely((error= table->file->ha_update_tmp_row(table->record[1],
                                                         table->record[0]))))
@@ -21683,8 +21913,15 @@ end_update(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
       table->file->print_error(error,MYF(0));	/* purecov: inspected */
       DBUG_RETURN(NESTED_LOOP_ERROR);            /* purecov: inspected */
     }
+    if (aggr->last_group_key)
+    {
+      store_record(table,record[1]);
+      memcpy(aggr->last_group_key, param->group_buff, param->group_length);
+      aggr->last_group_positioned= true;
+    }
     goto end;
   }
+  aggr->last_group_positioned= false;
 
   init_tmptable_sum_functions(join->sum_funcs);
   if (unlikely(copy_funcs(join_tab->tmp_table_param->items_to_copy,
@@ -28314,7 +28551,20 @@ AGGR_OP::prepare_tmp_table()
   /* If it wasn't already, start index scan for grouping using table index. */
   if (!table->file->inited && table->group &&
       join_tab->tmp_table_param->sum_func_count && table->s->keys)
+  {
+    /*
+      end_update() may skip the lookup of the group of a row if the row
+      belongs to the group updated last. This requires the handler to stay
+      positioned at the updated row, which only HEAP guarantees, and
+      record[1] to keep a copy of the row, which is not safe with blobs.
+    */
+    last_group_positioned= false;
+    if (!last_group_key && table->s->db_type() == heap_hton &&
+        !table->s->blob_fields)
+      last_group_key= (uchar*) join->thd->alloc(join_tab->tmp_table_param->
+                                                group_length);
     rc= table->file->ha_index_init(0, 0);
+  }
   else
   {
     /* Start index scan in scanning mode */
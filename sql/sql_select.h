@@ -1039,7 +1039,19 @@ class AGGR_OP :public Sql_alloc
 public:
   JOIN_TAB *join_tab;
 
-  AGGR_OP(JOIN_TAB *tab) : join_tab(tab), write_func(NULL)
+  /*
+    Copy of the group key of the last row updated by end_update(), or NULL
+    if runs of rows of the same group cannot skip the lookup of the group
+  */
+  uchar *last_group_key;
+  /*
+    TRUE <=> the tmp table is positioned at the row of the group with the key
+    last_group_key and record[1] contains this row
+  */
+  bool last_group_positioned;
+
+  AGGR_OP(JOIN_TAB *tab) : join_tab(tab), last_group_key(NULL),
+    last_group_positioned(false), write_func(NULL)
   {};
 
   enum_nested_loop_state put_record() { return put_record(false); };
@@ -1064,6 +1076,40 @@ class AGGR_OP :public Sql_alloc
 };
 
 
+/*
+  The join order chosen for a select of a prepared statement, saved in the
+  SELECT_LEX to be reused by the following executions of the statement
+  (see optimizer_reuse_join_order)
+*/
+struct st_saved_join_order
+{
+  /* The number of elements allocated in the arrays below */
+  uint size;
+  /* The number of non-constant tables in the saved join order */
+  uint tables;
+  /* The non-constant tables in the join order */
+  TABLE_LIST **order;
+  /* The versions of the definitions of the tables when they were saved */
+  ulong *versions;
+  /*
+    TRUE <=> an execution has shown bad estimates for the saved order, the
+    next execution is to search for a join order again
+  */
+  bool reoptimize;
+  /*
+    TRUE <=> searching again has given the same join order, so the saved
+    order is kept whatever the estimates are
+  */
+  bool keep;
+};
+
+/*
+  A saved join order is dropped when an execution reads this many times
+  more rows from a table than it was estimated
+*/
+#define SAVED_JOIN_ORDER_MAX_ROWS_RATIO 100
+
+
 class JOIN :public Sql_alloc
 {
 private:
@@ -35,11 +35,15 @@ struct TABLE;
    The structure SORT_ADDON_FIELD describes a fixed layout
    for field values appended to sorted values in records to be sorted
    in the sort buffer.
-   Only fixed layout is supported now.
    Null bit maps for the appended values is placed before the values 
    themselves. Offsets are from the last sorted field, that is from the
    record referefence, which is still last component of sorted records.
    It is preserved for backward compatiblility.
+   With packed addon fields (see Sort_param::using_packed_addons) the
+   appended values start with their total length stored in
+   SORT_ADDON_LENGTH_BYTES bytes, the null bit maps follow and the values
+   are stored one after another without padding. Then only the offset
+   of the first value is used.
    The structure is used tp store values of the additional fields 
    in the sort buffer. It is used also when these values are read
    from a temporary file/buffer. As the reading procedures are beyond the
@@ -47,6 +51,8 @@ struct TABLE;
    the callback function 'unpack_addon_fields'.
 */
 
+#define SORT_ADDON_LENGTH_BYTES 2
+
 typedef struct st_sort_addon_field
 {
   /* Sort addon packed field */
@@ -79,6 +85,11 @@ class Sort_param {
   SORT_FIELD *end;
   SORT_ADDON_FIELD *addon_field; // Descriptors for companion fields.
   LEX_STRING addon_buf;          // Buffer & length of added packed fields.
+  /*
+    Addon fields are stored with their actual length, so that the records
+    written to the temporary files are of different length.
+  */
+  bool using_packed_addons;
 
   uchar *unique_buff;
   bool not_killable;
@@ -93,6 +104,20 @@ class Sort_param {
   }
   void init_for_filesort(uint sortlen, TABLE *table,
                          ha_rows maxrows, bool sort_positions);
+
+  /// Length of the appended values of a record with packed addon fields.
+  static uint get_addon_length(const uchar *addons)
+  {
+    return uint2korr(addons);
+  }
+
+  /// Length of the record starting at the given position.
+  uint get_record_length(const uchar *record) const
+  {
+    if (!using_packed_addons)
+      return rec_length;
+    return sort_length + get_addon_length(record + sort_length);
+  }
 };
 
 
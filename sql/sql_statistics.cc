@@ -1834,7 +1834,7 @@ class Index_prefix_calc: public Sql_alloc
     
 public:
 
-  bool is_single_comp_pk;
+  bool is_single_comp_unique;
   bool is_partial_fields_present;
 
   Index_prefix_calc(THD *thd, TABLE *table, KEY *key_info)
@@ -1847,20 +1847,37 @@ class Index_prefix_calc: public Sql_alloc
     prefixes= 0;
     LINT_INIT_STRUCT(calc_state);
 
-    is_partial_fields_present= is_single_comp_pk= FALSE;
+    is_partial_fields_present= is_single_comp_unique= FALSE;
     uint pk= table->s->primary_key;
     if ((uint) (table->key_info - key_info) == pk &&
         table->key_info[pk].user_defined_key_parts == 1)
     {
       prefixes= 1;
-      is_single_comp_pk= TRUE;
+      is_single_comp_unique= TRUE;
+      return;
+    }
+
+    /*
+      Every prefix of a unique index over one whole NOT NULL column,
+      including the prefixes extended with primary key components, is
+      unique. So 'avg_frequency' is 1 for all of them and the index does
+      not have to be scanned.
+    */
+    uint keyno= (uint) (key_info - table->key_info);
+    if ((key_info->flags & HA_NOSAME) &&
+        !(key_info->flags & HA_NULL_PART_KEY) &&
+        key_info->algorithm != HA_KEY_ALG_LONG_HASH &&
+        key_info->user_defined_key_parts == 1 &&
+        key_info->key_part[0].field->part_of_key.is_set(keyno))
+    {
+      prefixes= key_parts;
+      is_single_comp_unique= TRUE;
       return;
     }
         
     if ((calc_state=
          (Prefix_calc_state *) thd->alloc(sizeof(Prefix_calc_state)*key_parts)))
     {
-      uint keyno= (uint)(key_info-table->key_info);
       for (i= 0, state= calc_state; i < key_parts; i++, state++)
       {
         /* 
@@ -1943,9 +1960,10 @@ class Index_prefix_calc: public Sql_alloc
     uint i;
     Prefix_calc_state *state;
 
-    if (is_single_comp_pk)
+    if (is_single_comp_unique)
     {
-      index_info->collected_stats->set_avg_frequency(0, 1.0);
+      for (i= 0; i < prefixes; i++)
+        index_info->collected_stats->set_avg_frequency(i, 1.0);
       return;
     }
 
@@ -2701,7 +2719,7 @@ int collect_statistics_for_index(THD *thd, TABLE *table, uint index)
   DEBUG_SYNC(table->in_use, "statistics_collection_start1");
   DEBUG_SYNC(table->in_use, "statistics_collection_start2");
 
-  if (index_prefix_calc.is_single_comp_pk)
+  if (index_prefix_calc.is_single_comp_unique)
   {
     index_prefix_calc.get_avg_frequency();
     DBUG_RETURN(rc);
@@ -3805,6 +3823,30 @@ void set_statistics_for_table(THD *thd, TABLE *table)
      !table->stats_is_read || read_stats->cardinality_is_null) ?
     table->file->stats.records : read_stats->cardinality;
 
+  /*
+    The statistical tables are refreshed only by ANALYZE. If the table has
+    been changed considerably since then, the number of rows reported by
+    the engine is closer to the truth than the recorded one.
+    The statistics on indexes are not used then, and the average
+    frequencies of columns are scaled to the new number of rows.
+  */
+  table->stale_stat_records= FALSE;
+  if (thd->variables.stat_tables_stale_percentage &&
+      table->used_stat_records != table->file->stats.records)
+  {
+    ha_rows stat_records= table->used_stat_records;
+    ha_rows engine_records= table->file->stats.records;
+    ha_rows diff= stat_records > engine_records ?
+                  stat_records - engine_records :
+                  engine_records - stat_records;
+    if ((double) diff * 100 >
+        (double) stat_records * thd->variables.stat_tables_stale_percentage)
+    {
+      table->used_stat_records= engine_records;
+      table->stale_stat_records= TRUE;
+    }
+  }
+
   /*
     For partitioned table, EITS statistics is based on data from all partitions.
 
@@ -3827,6 +3869,7 @@ void set_statistics_for_table(THD *thd, TABLE *table)
     key_info->is_statistics_from_stat_tables=
       (check_eits_preferred(thd) &&
        table->stats_is_read &&
+       !table->stale_stat_records &&
        key_info->read_stats->avg_frequency_is_inited() &&
        key_info->read_stats->get_avg_frequency(0) > 0.5);
   }
@@ -3865,7 +3908,13 @@ double get_column_avg_frequency(Field * field)
   if (!col_stats)
     res= (double)table->stat_records();
   else
+  {
     res= col_stats->get_avg_frequency();
+    /* Assume the number of distinct values has not changed */
+    Table_statistics *read_stats= table->s->stats_cb.table_stats;
+    if (table->stale_stat_records && read_stats->cardinality)
+      res*= (double) table->stat_records() / read_stats->cardinality;
+  }
   return res;
 } 
 
@@ -3940,7 +3989,7 @@ double get_column_range_cardinality(Field *field,
     }
     else
     {
-      double avg_frequency= col_stats->get_avg_frequency();
+      double avg_frequency= get_column_avg_frequency(field);
       res= avg_frequency;   
       if (avg_frequency > 1.0 + 0.000001 && 
           col_stats->min_max_values_are_provided())
@@ -3995,7 +4044,7 @@ double get_column_range_cardinality(Field *field,
       else
         sel= hist->range_selectivity(min_mp_pos, max_mp_pos);
       res= col_non_nulls * sel;
-      set_if_bigger(res, col_stats->get_avg_frequency());
+      set_if_bigger(res, get_column_avg_frequency(field));
     }
     else
       res= col_non_nulls;
@@ -4007,6 +4056,52 @@ double get_column_range_cardinality(Field *field,
 
 
 
+/*
+  @brief
+    Estimate selectivity of "min_pos <= col <= max_pos" using a histogram
+
+  @detail
+    All buckets between the bucket with min_pos and the bucket with max_pos
+    are fully covered by the range. The end buckets are covered only partially
+    when the range end point lies strictly inside the bucket: we assume that
+    values are uniformly distributed inside a bucket and count only the part
+    of its rows that falls into the range. If an end point is equal to a
+    bucket bound, the whole bucket is counted, as the bound value may take
+    any share of the bucket's rows.
+*/
+
+double Histogram::range_selectivity(double min_pos, double max_pos)
+{
+  double bucket_sel= 1.0/(get_width() + 1);
+  uint min= find_bucket(min_pos, TRUE);
+  uint max= find_bucket(max_pos, FALSE);
+  uint min_value= (uint) (min_pos * prec_factor());
+  uint max_value= (uint) (max_pos * prec_factor());
+  double min_bucket_part= 1.0;
+  double max_bucket_part= 1.0;
+
+  uint left= min == 0 ? 0 : get_value(min - 1);
+  uint right= get_value(min);
+  if (min_value > left && min_value < right)
+  {
+    if (max == min && max_value >= min_value && max_value < right)
+    {
+      /* The whole range is inside one bucket */
+      return bucket_sel * (max_value - min_value + 1) / (right - left + 1);
+    }
+    min_bucket_part= (double) (right - min_value + 1) / (right - left + 1);
+  }
+
+  left= max == 0 ? 0 : get_value(max - 1);
+  right= get_value(max);
+  if (max > min && max_value > left && max_value < right)
+    max_bucket_part= (double) (max_value - left + 1) / (right - left + 1);
+
+  return bucket_sel * ((double) (max - min) - 1 + min_bucket_part +
+                      max_bucket_part);
+}
+
+
 /*
   Estimate selectivity of "col=const" using a histogram
   
@@ -4112,11 +4207,13 @@ double Histogram::point_selectivity(double pos, double avg_sel)
     sel= avg_sel * avg_bucket_width / current_bucket_width;
 
     /*
-      (Q: if we just follow this proportion we may end up in a situation
-      where number of different values we expect to find in this bucket
-      exceeds the number of rows that this histogram has in a bucket. Are 
-      we ok with this or we would want to have certain caps?)
+      If we just follow this proportion we may end up in a situation where
+      the value is expected to have more rows than the bucket has. This can
+      happen when the bucket covers a narrow value range, that is, fewer
+      values than an average one. The value does not occupy the whole
+      bucket, so cap the estimate by the bucket selectivity.
     */
+    set_if_smaller(sel, avg_bucket_width);
   }
   return sel;
 }
@@ -264,16 +264,11 @@ class Histogram
     }
   }
 
-  double range_selectivity(double min_pos, double max_pos)
-  {
-    double sel;
-    double bucket_sel= 1.0/(get_width() + 1);  
-    uint min= find_bucket(min_pos, TRUE);
-    uint max= find_bucket(max_pos, FALSE);
-    sel= bucket_sel * (max - min + 1);
-    return sel;
-  } 
-  
+  /*
+    Estimate selectivity of "min_pos <= col <= max_pos" using a histogram
+  */
+  double range_selectivity(double min_pos, double max_pos);
+
   /*
     Estimate selectivity of "col=const" using a histogram
   */
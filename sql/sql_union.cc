@@ -512,28 +512,51 @@ bool select_union_direct::postponed_prepare(List<Item> &types)
 }
 
 
-bool select_union_direct::send_result_set_metadata(List<Item> &list, uint flags)
-{
-  if (done_send_result_set_metadata)
-    return false;
-  done_send_result_set_metadata= true;
+/*
+  Set global offset and limit to be used in send_data(). These can
+  be variables in prepared statements or stored programs, so they
+  must be reevaluated for each execution.
+*/
 
-  /*
-    Set global offset and limit to be used in send_data(). These can
-    be variables in prepared statements or stored programs, so they
-    must be reevaluated for each execution.
-   */
+void select_union_direct::init_offset_limit()
+{
   offset= unit->global_parameters()->get_offset();
   limit= unit->global_parameters()->get_limit();
   if (limit + offset >= limit)
     limit+= offset;
   else
     limit= HA_POS_ERROR; /* purecov: inspected */
+}
+
+
+bool select_union_direct::send_result_set_metadata(List<Item> &list, uint flags)
+{
+  if (done_send_result_set_metadata)
+    return false;
+  done_send_result_set_metadata= true;
+
+  init_offset_limit();
 
   return result->send_result_set_metadata(unit->types, flags);
 }
 
 
+/*
+  Get the number of rows the union can still accept before its global LIMIT
+  is reached, including the rows skipped because of OFFSET
+
+  @note
+    Can be called before the first SELECT of the union has been executed
+*/
+
+ha_rows select_union_direct::rows_left()
+{
+  if (!done_send_result_set_metadata)
+    init_offset_limit();
+  return limit;
+}
+
+
 int select_union_direct::send_data(List<Item> &items)
 {
   if (!limit)
@@ -1505,6 +1528,35 @@ bool st_select_lex_unit::exec()
 	  saved_error= sl->join->optimize();
 	}
       }
+      if (!fake_select_lex && !found_rows_for_union && !describe &&
+          !(with_element && with_element->is_recursive) &&
+          !sl->tvc && !sl->explicit_limit)
+      {
+        /*
+          UNION ALL sending its rows directly to the result: the rows after
+          the global LIMIT are thrown away. Don't execute the SELECTs that
+          can only produce such rows, and stop the others as soon as the
+          LIMIT is reached. If the last SELECT is skipped, EOF is sent
+          on its behalf.
+        */
+        ha_rows rows_left= ((select_union_direct *) union_result)->rows_left();
+        if (!rows_left)
+        {
+          if (sl->next_select())
+            continue;
+          thd->limit_found_rows= 0;
+          if (unlikely(union_result->send_result_set_metadata(types,
+                                                  Protocol::SEND_NUM_ROWS |
+                                                  Protocol::SEND_EOF)) ||
+              unlikely(union_result->send_eof()))
+          {
+            thd->lex->current_select= lex_select_save;
+            DBUG_RETURN(TRUE);
+          }
+          continue;
+        }
+        set_if_smaller(select_limit_cnt, rows_left);
+      }
       if (likely(!saved_error))
       {
 	records_at_start= table->file->stats.records;
@@ -1804,6 +1856,13 @@ bool st_select_lex_unit::exec_recursive()
   thd->inc_examined_row_count(examined_rows);
 
   incr_table->file->info(HA_STATUS_VARIABLE);
+  if (thd->lex->analyze_stmt)
+  {
+    Explain_union *eu=
+      thd->lex->explain->get_union(first_select()->select_number);
+    if (eu)
+      eu->add_recursive_iteration(incr_table->file->stats.records);
+  }
   if (with_element->level && incr_table->file->stats.records == 0)
     with_element->set_as_stabilized();
   else
@@ -2608,6 +2608,22 @@ static bool is_computed_with_remove(Item_sum::Sumfunctype sum_func)
       return true;
   }
 }
+
+/*
+  Check if the frame always starts at the first row of the partition.
+  Rows are then only added to the frame as the current row moves on,
+  never removed from it. This is also the case of the default frame,
+  RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW.
+*/
+static bool is_frame_top_unbounded(Window_spec *spec)
+{
+  Window_frame *frame= spec->window_frame;
+  if (!frame)
+    return true;
+  return frame->top_bound->precedence_type == Window_frame_bound::PRECEDING &&
+         frame->top_bound->offset == NULL;
+}
+
 /*
    Create required frame cursors for the list of window functions.
    Register all functions to their appropriate cursors.
@@ -2686,8 +2702,14 @@ void get_window_functions_required_cursors(
     */
     cursor_manager->add_cursor(frame_bottom);
     cursor_manager->add_cursor(frame_top);
+    /*
+      Functions that can not remove values (e.g. MIN, MAX) rescan the
+      whole frame for every row, unless the frame only grows: then the
+      values added by the bottom bound are enough.
+    */
     if (is_computed_with_remove(sum_func->sum_func()) &&
-        !sum_func->supports_removal())
+        !sum_func->supports_removal() &&
+        !is_frame_top_unbounded(item_win_func->window_spec))
     {
       frame_bottom->set_no_action();
       frame_top->set_no_action();
@@ -2528,6 +2528,15 @@ static Sys_var_ulong Sys_optimizer_prune_level(
        SESSION_VAR(optimizer_prune_level), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(0, 1), DEFAULT(1), BLOCK_SIZE(1));
 
+static Sys_var_mybool Sys_optimizer_selectivity_backoff(
+       "optimizer_selectivity_backoff",
+       "Do not assume that conditions on different columns of a table are "
+       "independent. When combining their selectivities, use the most "
+       "selective one as is, the square root of the next one, the 4th root "
+       "of the next one and so on, instead of multiplying them",
+       SESSION_VAR(optimizer_selectivity_backoff), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
 static Sys_var_ulong Sys_optimizer_selectivity_sampling_limit(
        "optimizer_selectivity_sampling_limit",
        "Controls number of record samples to check condition selectivity",
@@ -2557,6 +2566,16 @@ static Sys_var_ulong Sys_optimizer_use_condition_selectivity(
        SESSION_VAR(optimizer_use_condition_selectivity), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(1, 5), DEFAULT(4), BLOCK_SIZE(1));
 
+static Sys_var_mybool Sys_optimizer_reuse_join_order(
+       "optimizer_reuse_join_order",
+       "Save the join order chosen for a SELECT of a prepared statement or "
+       "a stored routine statement and join the tables in this order in the "
+       "following executions, choosing only the access methods again. The "
+       "saved order is not used when other tables are constant or when the "
+       "definitions or the statistics of the tables have been reloaded",
+       SESSION_VAR(optimizer_reuse_join_order), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
 static Sys_var_ulong Sys_optimizer_search_depth(
        "optimizer_search_depth",
        "Maximum depth of search performed by the query optimizer. Values "
@@ -6063,6 +6082,16 @@ static Sys_var_ulonglong Sys_join_buffer_space_limit(
        VALID_RANGE(2048, ULONGLONG_MAX), DEFAULT(16*128*1024),
        BLOCK_SIZE(2048));
 
+static Sys_var_ulonglong Sys_join_buffer_hash_size_limit(
+       "join_buffer_hash_size_limit",
+       "The size up to which a hashed join buffer (BNLH, BKAH) may grow "
+       "beyond join_buffer_size when the rows to be joined are not expected "
+       "to fit into it. Used only with optimize_join_buffer_size=on, the "
+       "total size of join buffers is still limited by "
+       "join_buffer_space_limit. 0 means no growth",
+       SESSION_VAR(join_buff_hash_size_limit), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, ULONGLONG_MAX), DEFAULT(0), BLOCK_SIZE(2048));
+
 static Sys_var_ulong Sys_progress_report_time(
        "progress_report_time",
        "Seconds between sending progress reports to the client for "
@@ -6096,6 +6125,16 @@ static Sys_var_enum Sys_histogram_type(
        SESSION_VAR(histogram_type), CMD_LINE(REQUIRED_ARG),
        histogram_types, DEFAULT(1));
 
+static Sys_var_ulong Sys_stat_tables_stale_percentage(
+       "stat_tables_stale_percentage",
+       "If the number of rows in a table reported by the storage engine "
+       "differs by more than this percentage from the number of rows "
+       "recorded by the last ANALYZE in the statistical tables, the "
+       "optimizer uses the number reported by the engine. "
+       "Set to 0 to always use the recorded number.",
+       SESSION_VAR(stat_tables_stale_percentage), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, UINT_MAX), DEFAULT(0), BLOCK_SIZE(1));
+
 static Sys_var_mybool Sys_no_thread_alarm(
        "debug_no_thread_alarm",
        "Disable system thread alarm calls. Disabling it may be useful "
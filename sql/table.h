@@ -1217,6 +1217,11 @@ struct TABLE
 
   /* The estimate of the number of records in the table used by optimizer */ 
   ha_rows used_stat_records;
+  /*
+    TRUE <=> used_stat_records is the number of records reported by the
+    engine as the one recorded in the statistical tables is out of date
+  */
+  bool stale_stat_records;
 
   /* 
     For each key that has quick_keys.is_set(key) == TRUE: estimate of #records
@@ -51,6 +51,7 @@ Created 10/16/1994 Heikki Tuuri
 #include "rem0rec.h"
 #include "rem0cmp.h"
 #include "buf0lru.h"
+#include "buf0rea.h"
 #include "btr0btr.h"
 #include "btr0sea.h"
 #include "row0log.h"
@@ -6734,6 +6735,72 @@ btr_estimate_n_rows_in_range(
 		index, tuple1, mode1, tuple2, mode2, 1);
 }
 
+/** Issue an asynchronous read of the leaf page on which a search for
+a tuple would end, unless the page is already in the buffer pool.
+Only the non-leaf levels of the index are accessed. The page read is
+counted in MONITOR_MRR_READ_AHEAD.
+@param[in]	index	index
+@param[in]	tuple	search tuple */
+void
+btr_cur_prefetch_leaf(
+	dict_index_t*	index,
+	const dtuple_t*	tuple)
+{
+	mtr_t		mtr;
+	mem_heap_t*	heap = NULL;
+	ulint		offsets_[REC_OFFS_NORMAL_SIZE];
+	ulint*		offsets = offsets_;
+	rec_offs_init(offsets_);
+
+	ut_ad(dict_index_check_search_tuple(index, tuple));
+
+	const ulint	zip_size = index->table->space->zip_size();
+	page_id_t	page_id(index->table->space_id, index->page);
+
+	mtr.start();
+	mtr_s_lock(dict_index_get_lock(index), &mtr);
+
+	for (;;) {
+		const buf_block_t* block = btr_block_get(
+			page_id, zip_size, RW_S_LATCH, index, &mtr);
+
+		if (!block || page_is_leaf(buf_block_get_frame(block))) {
+			/* The root is a leaf: it is in the buffer pool */
+			break;
+		}
+
+		page_cur_t	page_cursor;
+		ulint		up_match = 0;
+		ulint		low_match = 0;
+
+		page_cur_search_with_match(block, index, tuple, PAGE_CUR_LE,
+					   &up_match, &low_match,
+					   &page_cursor, NULL);
+
+		const rec_t*	node_ptr = page_cur_get_rec(&page_cursor);
+
+		offsets = rec_get_offsets(node_ptr, index, offsets, false,
+					  ULINT_UNDEFINED, &heap);
+		page_id.set_page_no(
+			btr_node_ptr_get_child_page_no(node_ptr, offsets));
+
+		if (btr_page_get_level(buf_block_get_frame(block)) == 1) {
+			if (buf_read_page_background(page_id, zip_size,
+						     false)) {
+				MONITOR_ATOMIC_INC(MONITOR_MRR_READ_AHEAD);
+			}
+			os_aio_simulated_wake_handler_threads();
+			break;
+		}
+	}
+
+	mtr.commit();
+
+	if (heap) {
+		mem_heap_free(heap);
+	}
+}
+
 /*******************************************************************//**
 Record the number of non_null key values in a given index for
 each n-column prefix of the index where 1 <= n <= dict_index_get_n_unique(index).
@@ -3668,15 +3668,34 @@ buf_page_make_young_if_needed(
 	buf_page_t*	bpage)		/*!< in/out: buffer block of a
 					file page */
 {
-#ifdef UNIV_DEBUG
 	buf_pool_t*	buf_pool = buf_pool_from_bpage(bpage);
 	ut_ad(!buf_pool_mutex_own(buf_pool));
-#endif /* UNIV_DEBUG */
 	ut_a(buf_page_in_file(bpage));
 
+	if (!buf_page_peek_if_too_old(bpage)) {
+		return;
+	}
+
+	if (bpage->old) {
+		buf_pool_mutex_enter(buf_pool);
+	} else if (mutex_enter_nowait(&buf_pool->mutex)) {
+		/* The block is in the young sublist and in no danger
+		of being evicted soon. Do not wait for the contended
+		buf_pool->mutex just to move it closer to the head of
+		the LRU list; a later access will try again. */
+		MONITOR_ATOMIC_INC(MONITOR_LRU_MAKE_YOUNG_SKIPPED);
+		return;
+	}
+
+	ut_a(buf_page_in_file(bpage));
+
+	/* Another thread that accessed the block at the same time
+	may already have moved it while we waited for the mutex. */
 	if (buf_page_peek_if_too_old(bpage)) {
-		buf_page_make_young(bpage);
+		buf_LRU_make_block_young(bpage);
 	}
+
+	buf_pool_mutex_exit(buf_pool);
 }
 
 #ifdef UNIV_DEBUG
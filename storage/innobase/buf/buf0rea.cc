@@ -430,8 +430,9 @@ an exclusive lock on the buffer frame. The flag is cleared and the x-lock
 released by the i/o-handler thread.
 @param[in]	page_id		page id
 @param[in]	zip_size	ROW_FORMAT=COMPRESSED page size, or 0
-@param[in]	sync		true if synchronous aio is desired */
-void
+@param[in]	sync		true if synchronous aio is desired
+@return number of page read requests issued (0 or 1) */
+ulint
 buf_read_page_background(const page_id_t page_id, ulint zip_size, bool sync)
 {
 	ulint		count;
@@ -471,6 +472,7 @@ buf_read_page_background(const page_id_t page_id, ulint zip_size, bool sync)
 	buffer pool. Since this function is called from buffer pool load
 	these IOs are deliberate and are not part of normal workload we can
 	ignore these in our heuristics. */
+	return(count);
 }
 
 /** Applies linear read-ahead if in the buf_pool the page is a border page of
@@ -9712,6 +9712,55 @@ ha_innobase::rnd_pos(
 	DBUG_RETURN(error);
 }
 
+/**********************************************************************//**
+Starts reading the clustered index leaf page of a row in the background,
+if innodb_mrr_read_ahead is set. Used by multi-range reads, which call this
+for all rowids in their buffer before fetching the rows with rnd_pos().
+@return whether the rows of the table are read ahead */
+
+bool
+ha_innobase::rnd_pos_prefetch(
+/*==========================*/
+	const uchar*	pos)	/*!< in: primary key value of the row in the
+				MySQL format */
+{
+	if (!srv_mrr_read_ahead
+	    || m_prebuilt->clust_index_was_generated
+	    || !m_prebuilt->srch_key_val2
+	    || !m_prebuilt->table->space) {
+		return(false);
+	}
+
+	dict_index_t*	index = dict_table_get_first_index(m_prebuilt->table);
+
+	if (index->is_corrupted()) {
+		return(false);
+	}
+
+	const ulint	n_uniq = dict_index_get_n_unique(index);
+	byte		tuple_buf[DTUPLE_EST_ALLOC(MAX_REF_PARTS)];
+
+	ut_ad(n_uniq <= MAX_REF_PARTS);
+
+	dtuple_t*	tuple = dtuple_create_from_mem(
+		tuple_buf, sizeof tuple_buf, n_uniq, 0);
+	dict_index_copy_types(tuple, index, n_uniq);
+
+	row_sel_convert_mysql_key_to_innobase(
+		tuple,
+		m_prebuilt->srch_key_val2,
+		m_prebuilt->srch_key_val_len,
+		index,
+		(byte*) pos,
+		(ulint) ref_length);
+
+	if (dtuple_get_n_fields(tuple) == n_uniq) {
+		btr_cur_prefetch_leaf(index, tuple);
+	}
+
+	return(true);
+}
+
 /**********************************************************************//**
 Initialize FT index scan
 @return 0 or error number */
@@ -19435,6 +19484,12 @@ static MYSQL_SYSVAR_BOOL(random_read_ahead, srv_random_read_ahead,
   "Whether to use read ahead for random access within an extent.",
   NULL, NULL, FALSE);
 
+static MYSQL_SYSVAR_BOOL(mrr_read_ahead, srv_mrr_read_ahead,
+  PLUGIN_VAR_NOCMDARG,
+  "Whether to start reading the clustered index leaf pages of all rows"
+  " in a multi-range read buffer before the rows are fetched.",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_ULONG(read_ahead_threshold, srv_read_ahead_threshold,
   PLUGIN_VAR_RQCMDARG,
   "Number of pages that must be accessed sequentially for InnoDB to"
@@ -19844,6 +19899,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(disallow_writes),
 #endif /* WITH_INNODB_DISALLOW_WRITES */
   MYSQL_SYSVAR(random_read_ahead),
+  MYSQL_SYSVAR(mrr_read_ahead),
   MYSQL_SYSVAR(read_ahead_threshold),
   MYSQL_SYSVAR(read_only),
   MYSQL_SYSVAR(io_capacity),
@@ -160,6 +160,8 @@ class ha_innobase: public handler
 
 	int rnd_pos(uchar * buf, uchar *pos);
 
+	bool rnd_pos_prefetch(const uchar* pos);
+
 	int ft_init();
 	void ft_end() { rnd_end(); }
 	FT_INFO *ft_init_ext(uint flags, uint inx, String* key);
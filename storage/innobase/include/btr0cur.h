@@ -613,6 +613,17 @@ btr_estimate_n_rows_in_range(
 	const dtuple_t*	tuple2,
 	page_cur_mode_t	mode2);
 
+/** Issue an asynchronous read of the leaf page on which a search for
+a tuple would end, unless the page is already in the buffer pool.
+Only the non-leaf levels of the index are accessed. The page read is
+counted as a read-ahead page.
+@param[in]	index	index
+@param[in]	tuple	search tuple */
+void
+btr_cur_prefetch_leaf(
+	dict_index_t*	index,
+	const dtuple_t*	tuple);
+
 /*******************************************************************//**
 Estimates the number of different key values in a given index, for
 each n-column prefix of the index where 1 <= n <= dict_index_get_n_unique(index).
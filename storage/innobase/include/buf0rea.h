@@ -48,8 +48,9 @@ an exclusive lock on the buffer frame. The flag is cleared and the x-lock
 released by the i/o-handler thread.
 @param[in]	page_id		page id
 @param[in]	zip_size	ROW_FORMAT=COMPRESSED page size, or 0
-@param[in]	sync		true if synchronous aio is desired */
-void
+@param[in]	sync		true if synchronous aio is desired
+@return number of page read requests issued (0 or 1) */
+ulint
 buf_read_page_background(const page_id_t page_id, ulint zip_size, bool sync);
 
 /** Applies a random read-ahead in buf_pool if there are at least a threshold
@@ -2138,6 +2138,12 @@ struct dict_table_t {
 	/** List of locks on the table. Protected by lock_sys.mutex. */
 	table_lock_list_t			locks;
 
+	/** Number of granted or pending LOCK_S or LOCK_X in locks.
+	When it is zero, LOCK_IS and LOCK_IX requests cannot conflict
+	with anything and the scans of locks can be skipped.
+	Protected by lock_sys.mutex. */
+	ulint					n_lock_x_or_s;
+
 	/** Timestamp of the last modification of this table. */
 	time_t					update_time;
 
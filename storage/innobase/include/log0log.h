@@ -163,8 +163,9 @@ wait and check if an already running write is covering the request.
 included in the redo log file write
 @param[in]	flush_to_disk	whether the written log should also
 be flushed to the file system
-@param[in]	rotate_key	whether to rotate the encryption key */
-void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key = false);
+@param[in]	rotate_key	whether to rotate the encryption key
+@return	whether this call wrote the log buffer to the log file */
+bool log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key = false);
 
 /** write to the log file up to the last log entry.
 @param[in]	sync	whether we want the written log
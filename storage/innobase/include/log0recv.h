@@ -190,6 +190,8 @@ struct recv_sys_t{
 	buf_flush_t		flush_type;/*!< type of the flush request.
 				BUF_FLUSH_LRU: flush end of LRU, keeping free blocks.
 				BUF_FLUSH_LIST: flush all of blocks. */
+	/** event set when the last page of a batch has been processed */
+	os_event_t		apply_done;
 	/** whether recv_recover_page(), invoked from buf_page_io_complete(),
 	should apply log records*/
 	bool		apply_log_recs;
@@ -565,6 +565,11 @@ struct mysql_row_templ_t {
 #define MYSQL_FETCH_CACHE_SIZE		8
 /* After fetching this many rows, we start caching them in fetch_cache */
 #define MYSQL_FETCH_CACHE_THRESHOLD	4
+/* The maximum number of rows in fetch_cache of a long scan */
+#define MYSQL_FETCH_CACHE_MAX_SIZE	64
+/* fetch_cache may hold more than MYSQL_FETCH_CACHE_SIZE rows only as long
+as they fit in this many bytes */
+#define MYSQL_FETCH_CACHE_MAX_BYTES	16384
 
 #define ROW_PREBUILT_ALLOCATED	78540783
 #define ROW_PREBUILT_FREED	26423527
@@ -737,7 +742,7 @@ struct row_prebuilt_t {
 	ulint		n_rows_fetched;	/*!< number of rows fetched after
 					positioning the current cursor */
 	ulint		fetch_direction;/*!< ROW_SEL_NEXT or ROW_SEL_PREV */
-	byte*		fetch_cache[MYSQL_FETCH_CACHE_SIZE];
+	byte*		fetch_cache[MYSQL_FETCH_CACHE_MAX_SIZE];
 					/*!< a cache for fetched rows if we
 					fetch many rows from the same cursor:
 					it saves CPU time to fetch them in a
@@ -746,7 +751,8 @@ struct row_prebuilt_t {
 					pointers point 4 bytes past the
 					allocated mem buf start, because
 					there is a 4 byte magic number at the
-					start and at the end */
+					start and at the end; only the first
+					fetch_cache_size() pointers are used */
 	bool		keep_other_fields_on_keyread; /*!< when using fetch
 					cache with HA_EXTRA_KEYREAD, don't
 					overwrite other fields in mysql row
@@ -755,6 +761,8 @@ struct row_prebuilt_t {
 					fetched row in fetch_cache */
 	ulint		n_fetch_cached;	/*!< number of not yet fetched rows
 					in fetch_cache */
+	ulint		n_fetch_batch;	/*!< fetch_cache_batch() at the time
+					fetch_cache was last filled */
 	mem_heap_t*	blob_heap;	/*!< in SELECTS BLOB fields are copied
 					to this heap */
 	mem_heap_t*	old_vers_heap;	/*!< memory heap where a previous
@@ -813,6 +821,25 @@ struct row_prebuilt_t {
 	/** The MySQL table object */
 	TABLE*		m_mysql_table;
 
+	/** @return the number of rows that fit in fetch_cache */
+	ulint fetch_cache_size() const
+	{
+		ulint n = MYSQL_FETCH_CACHE_MAX_BYTES / (mysql_row_len + 8);
+		return ut_min(ut_max(n, ulint(MYSQL_FETCH_CACHE_SIZE)),
+			      ulint(MYSQL_FETCH_CACHE_MAX_SIZE));
+	}
+
+	/** @return the number of rows to prefetch into fetch_cache;
+	the batch grows with the number of rows fetched from the cursor,
+	so that long scans are served in larger batches while short
+	ones (e.g. with LIMIT) do not convert rows that are not needed */
+	ulint fetch_cache_batch() const
+	{
+		return ut_min(ut_max(n_rows_fetched,
+				     ulint(MYSQL_FETCH_CACHE_SIZE)),
+			      fetch_cache_size());
+	}
+
 	/** Get template by dict_table_t::cols[] number */
 	const mysql_row_templ_t* get_template_by_col(ulint col) const
 	{
@@ -165,6 +165,7 @@ enum monitor_id_t {
 	MONITOR_OVLD_BUF_POOL_WAIT_FREE,
 	MONITOR_OVLD_BUF_POOL_READ_AHEAD,
 	MONITOR_OVLD_BUF_POOL_READ_AHEAD_EVICTED,
+	MONITOR_MRR_READ_AHEAD,
 	MONITOR_OVLD_BUF_POOL_PAGE_TOTAL,
 	MONITOR_OVLD_BUF_POOL_PAGE_MISC,
 	MONITOR_OVLD_BUF_POOL_PAGES_DATA,
@@ -208,6 +209,7 @@ enum monitor_id_t {
 
 	MONITOR_LRU_GET_FREE_LOOPS,
 	MONITOR_LRU_GET_FREE_WAITS,
+	MONITOR_LRU_MAKE_YOUNG_SKIPPED,
 
 	MONITOR_FLUSH_AVG_PAGE_RATE,
 	MONITOR_FLUSH_LSN_AVG_RATE,
@@ -332,6 +334,8 @@ enum monitor_id_t {
 	MONITOR_OVLD_LOG_WRITE_REQUEST,
 	MONITOR_OVLD_LOG_WRITES,
 	MONITOR_OVLD_LOG_PADDED,
+	MONITOR_LOG_FLUSH_WAITS,
+	MONITOR_LOG_WRITES_DURING_FLUSH,
 
 	/* Page Manager related counters */
 	MONITOR_MODULE_PAGE,
@@ -383,6 +383,7 @@ extern ulint	srv_lock_table_size;
 
 extern ulint	srv_n_file_io_threads;
 extern my_bool	srv_random_read_ahead;
+extern my_bool	srv_mrr_read_ahead;
 extern ulong	srv_read_ahead_threshold;
 extern ulong	srv_n_read_io_threads;
 extern ulong	srv_n_write_io_threads;
@@ -3490,8 +3490,16 @@ lock_table_create(
 
 	check_trx_state(trx);
 
-	if ((type_mode & LOCK_MODE_MASK) == LOCK_AUTO_INC) {
+	switch (LOCK_MODE_MASK & type_mode) {
+	case LOCK_AUTO_INC:
 		++table->n_waiting_or_granted_auto_inc_locks;
+		break;
+	case LOCK_S:
+	case LOCK_X:
+		++table->n_lock_x_or_s;
+		break;
+	default:
+		break;
 	}
 
 	/* For AUTOINC locking we reuse the lock instance only if
@@ -3705,6 +3713,10 @@ lock_table_remove_low(
 
 		ut_a(table->n_waiting_or_granted_auto_inc_locks > 0);
 		table->n_waiting_or_granted_auto_inc_locks--;
+	} else if (lock_get_mode(lock) == LOCK_S
+		   || lock_get_mode(lock) == LOCK_X) {
+		ut_ad(table->n_lock_x_or_s > 0);
+		table->n_lock_x_or_s--;
 	}
 
 	UT_LIST_REMOVE(trx->lock.trx_locks, lock);
@@ -3819,6 +3831,11 @@ lock_table_other_has_incompatible(
 
 	ut_ad(lock_mutex_own());
 
+	/* Intention locks only conflict with LOCK_S or LOCK_X. */
+	if ((mode == LOCK_IS || mode == LOCK_IX) && !table->n_lock_x_or_s) {
+		return(NULL);
+	}
+
 	for (lock = UT_LIST_GET_LAST(table->locks);
 	     lock != NULL;
 	     lock = UT_LIST_GET_PREV(un_member.tab_lock.locks, lock)) {
@@ -4014,10 +4031,19 @@ lock_table_dequeue(
 	ut_ad(lock_mutex_own());
 	ut_a(lock_get_type_low(in_lock) == LOCK_TABLE);
 
+	const dict_table_t* table = in_lock->un_member.tab_lock.table;
+	const bool intention = lock_get_mode(in_lock) == LOCK_IS
+		|| lock_get_mode(in_lock) == LOCK_IX;
 	lock_t*	lock = UT_LIST_GET_NEXT(un_member.tab_lock.locks, in_lock);
 
 	lock_table_remove_low(in_lock);
 
+	if (intention && !table->n_lock_x_or_s) {
+		/* Only LOCK_S or LOCK_X requests can have been
+		waiting for LOCK_IS or LOCK_IX. */
+		return;
+	}
+
 	/* Check if waiting locks in the queue can now be granted: grant
 	locks if there are no conflicting locks ahead. */
 
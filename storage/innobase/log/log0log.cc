@@ -846,8 +846,9 @@ wait and check if an already running write is covering the request.
 included in the redo log file write
 @param[in]	flush_to_disk	whether the written log should also
 be flushed to the file system
-@param[in]	rotate_key	whether to rotate the encryption key */
-void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
+@param[in]	rotate_key	whether to rotate the encryption key
+@return	whether this call wrote the log buffer to the log file */
+bool log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
 {
 #ifdef UNIV_DEBUG
 	ulint		loop_count	= 0;
@@ -862,7 +863,7 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
 		/* Recovery is running and no operations on the log files are
 		allowed yet (the variable name .._no_ibuf_.. is misleading) */
 
-		return;
+		return false;
 	}
 
 loop:
@@ -875,7 +876,7 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
 	contention also works as the arbitrator for write-IO
 	(fsync) bandwidth between log files and data files. */
 	if (!flush_to_disk && log_sys.write_lsn >= lsn) {
-		return;
+		return false;
 	}
 #endif
 
@@ -888,7 +889,7 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
 
 	if (limit_lsn >= lsn) {
 		log_write_mutex_exit();
-		return;
+		return false;
 	}
 
 	/* If it is a write call we should just go ahead and do it
@@ -905,10 +906,23 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
 
 		log_write_mutex_exit();
 
+		MONITOR_ATOMIC_INC(MONITOR_LOG_FLUSH_WAITS);
+
+		if (!work_done && !rotate_key) {
+			/* Write out the log buffer while the pending
+			flush is running, so that the next flush
+			covers all requests that are now waiting and
+			does not need to write anything itself. */
+			if (log_write_up_to(lsn, false)) {
+				MONITOR_ATOMIC_INC(
+					MONITOR_LOG_WRITES_DURING_FLUSH);
+			}
+		}
+
 		os_event_wait(log_sys.flush_event);
 
 		if (work_done) {
-			return;
+			return false;
 		} else {
 			goto loop;
 		}
@@ -919,7 +933,7 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
 	    && log_sys.buf_free == log_sys.buf_next_to_write) {
 		/* Nothing to write and no flush to disk requested */
 		log_mutex_exit_all();
-		return;
+		return false;
 	}
 
 	ulint		start_offset;
@@ -942,7 +956,7 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
 			log_mutex_exit_all();
 			log_write_flush_to_disk_low();
 			log_mutex_exit();
-			return;
+			return false;
 		}
 	}
 
@@ -1033,6 +1047,8 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
 
 		innobase_mysql_log_notify(flush_lsn);
 	}
+
+	return true;
 }
 
 /** write to the log file up to the last log entry.
@@ -730,6 +730,10 @@ void recv_sys_t::close()
 			os_event_destroy(flush_end);
 		}
 
+		if (apply_done) {
+			os_event_destroy(apply_done);
+		}
+
 		if (buf) {
 			ut_free_dodump(buf, buf_size);
 			buf = NULL;
@@ -826,8 +830,10 @@ void recv_sys_t::create()
 	ut_ad(!is_initialised());
 	ut_ad(!flush_start);
 	ut_ad(!flush_end);
+	ut_ad(!apply_done);
 	mutex_create(LATCH_ID_RECV_SYS, &mutex);
 	mutex_create(LATCH_ID_RECV_WRITER, &writer_mutex);
+	apply_done = os_event_create(0);
 
 	heap = mem_heap_create_typed(256, MEM_HEAP_FOR_RECV_SYS);
 
@@ -2092,6 +2098,8 @@ static void recv_recover_page(buf_block_t* block, mtr_t& mtr,
 			service_manager_extend_timeout(
 				INNODB_EXTEND_TIMEOUT_INTERVAL, "To recover: " ULINTPF " pages from log", n);
 		}
+	} else {
+		os_event_set(recv_sys.apply_done);
 	}
 }
 
@@ -2361,13 +2369,17 @@ void recv_apply_hashed_log_recs(bool last_batch)
 				" to ignore corrupted pages.";
 		}
 
+		/* The event is set by recv_recover_page() while
+		holding recv_sys.mutex, so resetting it here cannot
+		lose the wakeup for the last page. */
+		os_event_reset(recv_sys.apply_done);
 		mutex_exit(&(recv_sys.mutex));
 
 		if (abort) {
 			return;
 		}
 
-		os_thread_sleep(500000);
+		os_event_wait_time(recv_sys.apply_done, 500000);
 
 		mutex_enter(&(recv_sys.mutex));
 	}
@@ -2379,6 +2391,13 @@ void recv_apply_hashed_log_recs(bool last_batch)
 		mutex_exit(&(recv_sys.mutex));
 		log_mutex_exit();
 
+		/* The last pages may still be io-fixed by the threads
+		that applied the log to them in buf_page_io_complete().
+		They could be neither flushed nor invalidated. */
+		while (buf_get_n_pending_read_ios()) {
+			os_thread_sleep(1000);
+		}
+
 		/* Stop the recv_writer thread from issuing any LRU
 		flush batches. */
 		mutex_enter(&recv_sys.writer_mutex);
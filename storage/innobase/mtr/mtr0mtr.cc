@@ -326,14 +326,32 @@ struct DebugCheck {
 	}
 };
 
+/** Which blocks mtr_t::Command::release_blocks() processes */
+enum mtr_release_t {
+	/** All blocks */
+	MTR_RELEASE_ALL,
+	/** The blocks that are not in the flush list yet. Their
+	insertion must be ordered by log_sys.flush_order_mutex. */
+	MTR_RELEASE_CLEAN,
+	/** The blocks that were already in the flush list before
+	the mini-transaction, after MTR_RELEASE_CLEAN */
+	MTR_RELEASE_DIRTY
+};
+
 /** Release a resource acquired by the mini-transaction. */
 struct ReleaseBlocks {
-	/** Release specific object */
-	ReleaseBlocks(lsn_t start_lsn, lsn_t end_lsn, FlushObserver* observer)
+	/** Release specific object
+	@param[in]	start_lsn	mini-transaction start LSN
+	@param[in]	end_lsn		mini-transaction end LSN
+	@param[in]	observer	flush observer
+	@param[in]	pass		which blocks to process */
+	ReleaseBlocks(lsn_t start_lsn, lsn_t end_lsn, FlushObserver* observer,
+		      mtr_release_t pass)
 		:
 		m_end_lsn(end_lsn),
 		m_start_lsn(start_lsn),
-		m_flush_observer(observer)
+		m_flush_observer(observer),
+		m_pass(pass)
 	{
 		/* Do nothing */
 	}
@@ -355,15 +373,40 @@ struct ReleaseBlocks {
 	/** @return true always. */
 	bool operator()(mtr_memo_slot_t* slot) const
 	{
-		if (slot->object != NULL) {
-
-			if (slot->type == MTR_MEMO_PAGE_X_FIX
-			    || slot->type == MTR_MEMO_PAGE_SX_FIX) {
+		if (slot->object == NULL
+		    || (slot->type != MTR_MEMO_PAGE_X_FIX
+			&& slot->type != MTR_MEMO_PAGE_SX_FIX)) {
+			return(true);
+		}
 
-				add_dirty_page_to_flush_list(slot);
+		/* The page is X or SX latched by us, so it cannot be
+		written out and its oldest_modification cannot change
+		between the passes. */
+		const buf_page_t& bpage = reinterpret_cast<buf_block_t*>(
+			slot->object)->page;
+
+		switch (m_pass) {
+		case MTR_RELEASE_ALL:
+			break;
+		case MTR_RELEASE_CLEAN:
+			if (bpage.oldest_modification != 0) {
+				return(true);
+			}
+			break;
+		case MTR_RELEASE_DIRTY:
+			/* Skip the blocks of MTR_RELEASE_CLEAN. Without
+			redo logging, m_end_lsn is not unique, but then
+			buf_flush_note_modification() would not change
+			anything either. */
+			if (bpage.newest_modification == m_end_lsn
+			    && bpage.flush_observer == m_flush_observer) {
+				return(true);
 			}
+			break;
 		}
 
+		add_dirty_page_to_flush_list(slot);
+
 		return(true);
 	}
 
@@ -375,6 +418,9 @@ struct ReleaseBlocks {
 
 	/** Flush observer */
 	FlushObserver*	m_flush_observer;
+
+	/** Which blocks to process */
+	mtr_release_t	m_pass;
 };
 
 class mtr_t::Command {
@@ -395,8 +441,9 @@ class mtr_t::Command {
 	release the resources. */
 	void execute();
 
-	/** Release the blocks used in this mini-transaction. */
-	void release_blocks();
+	/** Release the blocks used in this mini-transaction.
+	@param[in]	pass	which blocks to process */
+	void release_blocks(mtr_release_t pass);
 
 	/** Release the latches acquired by the mini-transaction. */
 	void release_latches();
@@ -875,11 +922,13 @@ mtr_t::Command::release_latches()
 	m_locks_released = 1;
 }
 
-/** Release the blocks used in this mini-transaction */
+/** Release the blocks used in this mini-transaction
+@param[in]	pass	which blocks to process */
 void
-mtr_t::Command::release_blocks()
+mtr_t::Command::release_blocks(mtr_release_t pass)
 {
-	ReleaseBlocks release(m_start_lsn, m_end_lsn, m_impl->m_flush_observer);
+	ReleaseBlocks release(m_start_lsn, m_end_lsn, m_impl->m_flush_observer,
+			      pass);
 	Iterate<ReleaseBlocks> iterator(release);
 
 	m_impl->m_memo.for_each_block_in_reverse(iterator);
@@ -907,10 +956,16 @@ mtr_t::Command::execute()
 
 	m_impl->m_mtr->m_commit_lsn = m_end_lsn;
 
-	release_blocks();
-
 	if (m_impl->m_made_dirty) {
+		/* Only the insertion of the pages that were clean into
+		the flush list must be ordered. The modification of the
+		pages that are already in the flush list is noted after
+		releasing the flush_order mutex. */
+		release_blocks(MTR_RELEASE_CLEAN);
 		log_flush_order_mutex_exit();
+		release_blocks(MTR_RELEASE_DIRTY);
+	} else {
+		release_blocks(MTR_RELEASE_ALL);
 	}
 
 	release_latches();
@@ -225,6 +225,12 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_EXISTING | MONITOR_DEFAULT_ON),
 	 MONITOR_DEFAULT_START, MONITOR_OVLD_BUF_POOL_READ_AHEAD_EVICTED},
 
+	{"buffer_mrr_read_ahead", "buffer",
+	 "Number of pages read ahead for MRR row lookups"
+	 " (innodb_mrr_read_ahead)",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_MRR_READ_AHEAD},
+
 	{"buffer_pool_pages_total", "buffer",
 	 "Total buffer pool size in pages (innodb_buffer_pool_pages_total)",
 	 static_cast<monitor_type_t>(
@@ -441,6 +447,12 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_NONE,
 	 MONITOR_DEFAULT_START, MONITOR_LRU_GET_FREE_WAITS},
 
+	{"buffer_LRU_make_young_skipped", "buffer",
+	 "Number of young pages not moved in LRU because the buffer pool"
+	 " mutex was busy",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_LRU_MAKE_YOUNG_SKIPPED},
+
 	{"buffer_flush_avg_page_rate", "buffer",
 	 "Average number of pages at which flushing is happening",
 	 MONITOR_NONE,
@@ -949,6 +961,16 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_EXISTING | MONITOR_DEFAULT_ON),
 	 MONITOR_DEFAULT_START, MONITOR_OVLD_LOG_PADDED},
 
+	{"log_flush_waits", "recovery",
+	 "Number of log flush requests that waited for a pending log flush",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_LOG_FLUSH_WAITS},
+
+	{"log_writes_during_flush", "recovery",
+	 "Number of log writes done while waiting for a pending log flush",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_LOG_WRITES_DURING_FLUSH},
+
 	/* ========== Counters for Page Compression ========== */
 	{"module_compress", "compression", "Page Compression Info",
 	 MONITOR_MODULE,
@@ -0,0 +1,82 @@
+/* Copyright (c) 2019, MariaDB
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/**
+  @file
+
+  Unit tests for the MSD radixsort of pointers to fixed length strings
+*/
+
+#include <my_global.h>
+#include <my_sys.h>
+#include <m_string.h>
+#include "tap.h"
+
+static size_t key_length;
+
+static int cmp_keys(const void *a, const void *b)
+{
+  return memcmp(*(const uchar**) a, *(const uchar**) b, key_length);
+}
+
+/*
+  Sort n_keys random keys of the given length whose bytes are taken from
+  n_values distinct values, the first prefix bytes being the same for all
+  keys, and check that the result is ordered.
+*/
+
+static void test_sort(uint n_keys, size_t length, uint n_values,
+                      size_t prefix)
+{
+  uchar *data= (uchar*) my_malloc(n_keys * length, MYF(MY_FAE));
+  uchar **keys= (uchar**) my_malloc(n_keys * sizeof(uchar*), MYF(MY_FAE));
+  uchar **buffer= (uchar**) my_malloc(n_keys * sizeof(uchar*), MYF(MY_FAE));
+  uint i, errors= 0;
+  size_t j;
+
+  for (i= 0; i < n_keys; i++)
+  {
+    keys[i]= data + i * length;
+    for (j= 0; j < length; j++)
+      keys[i][j]= j < prefix ? 'a' : (uchar) (rand() % n_values);
+  }
+  key_length= length;
+  radixsort_msd_for_str_ptr(keys, n_keys, length, buffer);
+  for (i= 1; i < n_keys; i++)
+    if (cmp_keys(keys + i - 1, keys + i) > 0)
+      errors++;
+  ok(errors == 0, "sort %u keys of length %u, %u values, prefix %u",
+     n_keys, (uint) length, n_values, (uint) prefix);
+
+  my_free(buffer);
+  my_free(keys);
+  my_free(data);
+}
+
+int main(int argc __attribute__((unused)), char **argv)
+{
+  MY_INIT(argv[0]);
+  plan(7);
+  srand(1);
+  test_sort(1000, 1, 256, 0);
+  test_sort(5000, 8, 256, 0);
+  test_sort(5000, 40, 2, 0);
+  test_sort(5000, 40, 256, 30);
+  test_sort(20000, 64, 4, 10);
+  test_sort(100, 300, 256, 0);
+  test_sort(200000, 24, 256, 0);
+  my_end(0);
+  return exit_status();
+}